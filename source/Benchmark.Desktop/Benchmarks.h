@@ -0,0 +1,12 @@
+#pragma once
+
+namespace Benchmark
+{
+	/** Measures how the job system scales from one thread up to every hardware thread on a CPU bound parallel for
+	 */
+	void RunJobSystemBenchmark();
+
+	/** Compares the throughput and distribution of FastHash and MixInteger against SuperFastHash
+	 */
+	void RunHashBenchmark();
+}
@@ -0,0 +1,210 @@
+#include "Pch.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include "Benchmarks.h"
+#include "HashFunctors.h"
+
+using namespace AnonymousEngine;
+using namespace std::chrono;
+
+namespace Benchmark
+{
+	// A byte hash being compared
+	struct HashEntry
+	{
+		const char* mName;
+		std::uint32_t (*mHash)(const std::int8_t*, std::uint32_t);
+	};
+
+	static const HashEntry Hashes[] =
+	{
+		{ "SuperFastHash", HashFunctions::SuperFastHash },
+		{ "FastHash", HashFunctions::FastHash }
+	};
+
+	// Bytes hashed for every key length of the throughput test
+	static const std::uint32_t ThroughputBytes = 64U << 20;
+	// Keys in every set of the quality test, and buckets they are spread over
+	static const std::uint32_t KeyCount = 1U << 20;
+	// Keys whose bits are flipped one at a time by the avalanche test
+	static const std::uint32_t AvalancheKeys = 2000U;
+
+	// Something which depends on every hash, so the optimizer can't throw them away
+	static std::uint32_t sSink = 0;
+
+	static double MegabytesPerSecond(std::uint32_t (*hash)(const std::int8_t*, std::uint32_t), const std::vector<std::int8_t>& data, std::uint32_t length)
+	{
+		std::uint32_t keys = std::max(ThroughputBytes / length, 1U);
+		std::uint32_t span = static_cast<std::uint32_t>(data.size()) - length;
+		high_resolution_clock::time_point start = high_resolution_clock::now();
+		for (std::uint32_t key = 0; key < keys; ++key)
+		{
+			// walk through the data so every key starts somewhere else, at any alignment
+			sSink += hash(data.data() + (key * 61U) % span, length);
+		}
+		double seconds = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+		return static_cast<double>(keys) * length / (1024.0 * 1024.0) / seconds;
+	}
+
+	// Count full hash collisions and the longest chain of a hashmap with one bucket per key
+	static void PrintDistribution(const char* name, const std::vector<std::uint32_t>& hashes)
+	{
+		std::vector<std::uint32_t> sorted(hashes);
+		std::sort(sorted.begin(), sorted.end());
+		std::uint32_t collisions = static_cast<std::uint32_t>(sorted.end() - std::unique(sorted.begin(), sorted.end()));
+
+		std::vector<std::uint32_t> chains(hashes.size());
+		for (std::uint32_t hash : hashes)
+		{
+			++chains[hash % chains.size()];
+		}
+		std::cout << std::setw(16) << name << std::setw(14) << collisions << std::setw(14) << *std::max_element(chains.begin(), chains.end());
+	}
+
+	// The largest distance from one half of how often each hash bit flips when one key bit flips
+	static double AvalancheBias(std::uint32_t (*hash)(const std::int8_t*, std::uint32_t), std::uint32_t length, std::mt19937& random)
+	{
+		std::vector<std::uint32_t> flips(32 * length * 8);
+		std::vector<std::int8_t> key(length);
+		for (std::uint32_t sample = 0; sample < AvalancheKeys; ++sample)
+		{
+			for (auto& byte : key)
+			{
+				byte = static_cast<std::int8_t>(random());
+			}
+			std::uint32_t original = hash(key.data(), length);
+			for (std::uint32_t bit = 0; bit < length * 8; ++bit)
+			{
+				key[bit / 8] ^= static_cast<std::int8_t>(1 << (bit % 8));
+				std::uint32_t changed = original ^ hash(key.data(), length);
+				key[bit / 8] ^= static_cast<std::int8_t>(1 << (bit % 8));
+				for (std::uint32_t outputBit = 0; outputBit < 32; ++outputBit)
+				{
+					flips[bit * 32 + outputBit] += (changed >> outputBit) & 1U;
+				}
+			}
+		}
+
+		double worst = 0.0;
+		for (std::uint32_t count : flips)
+		{
+			worst = std::max(worst, std::abs(static_cast<double>(count) / AvalancheKeys - 0.5));
+		}
+		return worst;
+	}
+
+	void RunHashBenchmark()
+	{
+		std::mt19937 random(12345U);
+		std::vector<std::int8_t> data(8U << 20);
+		for (auto& byte : data)
+		{
+			byte = static_cast<std::int8_t>(random());
+		}
+
+		std::cout << "Hash throughput (MB/s)" << std::endl;
+		std::cout << std::setw(8) << "Length";
+		for (const auto& entry : Hashes)
+		{
+			std::cout << std::setw(16) << entry.mName;
+		}
+		std::cout << std::endl;
+		const std::uint32_t lengths[] = { 4, 8, 16, 32, 64, 256, 4096 };
+		for (std::uint32_t length : lengths)
+		{
+			std::cout << std::setw(8) << length;
+			for (const auto& entry : Hashes)
+			{
+				std::cout << std::setw(16) << std::fixed << std::setprecision(0) << MegabytesPerSecond(entry.mHash, data, length);
+			}
+			std::cout << std::endl;
+		}
+
+		// integers hashed by their bytes, which is what DefaultHashFunctor used to do, against the integer mixer
+		std::cout << std::endl << "Integer keys (million keys/s)" << std::endl;
+		{
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for (std::uint32_t key = 0; key < ThroughputBytes; ++key)
+			{
+				sSink += HashFunctions::SuperFastHash(reinterpret_cast<const std::int8_t*>(&key), sizeof(key));
+			}
+			double bytesSeconds = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+			start = high_resolution_clock::now();
+			for (std::uint32_t key = 0; key < ThroughputBytes; ++key)
+			{
+				sSink += HashFunctions::MixInteger(key);
+			}
+			double mixSeconds = duration_cast<duration<double>>(high_resolution_clock::now() - start).count();
+			std::cout << std::setw(16) << "SuperFastHash" << std::setw(12) << std::setprecision(1) << ThroughputBytes / bytesSeconds / 1e6 << std::endl;
+			std::cout << std::setw(16) << "MixInteger" << std::setw(12) << ThroughputBytes / mixSeconds / 1e6 << std::endl;
+		}
+
+		std::cout << std::endl << "Hash quality, " << KeyCount << " keys into as many buckets (random hashes: about "
+			<< static_cast<std::uint64_t>(KeyCount) * KeyCount / (2ULL << 32) << " collisions, longest chain about 9)" << std::endl;
+		std::cout << std::setw(22) << "Keys" << std::setw(16) << "Hash" << std::setw(14) << "Collisions" << std::setw(14) << "Longest chain" << std::endl;
+		std::vector<std::uint32_t> hashes(KeyCount);
+		for (const auto& entry : Hashes)
+		{
+			for (std::uint32_t key = 0; key < KeyCount; ++key)
+			{
+				hashes[key] = entry.mHash(reinterpret_cast<const std::int8_t*>(&key), sizeof(key));
+			}
+			std::cout << std::setw(22) << "sequential integers";
+			PrintDistribution(entry.mName, hashes);
+			std::cout << std::endl;
+
+			for (std::uint32_t key = 0; key < KeyCount; ++key)
+			{
+				std::string name = "Entity_" + std::to_string(key);
+				hashes[key] = entry.mHash(reinterpret_cast<const std::int8_t*>(name.c_str()), static_cast<std::uint32_t>(name.size()));
+			}
+			std::cout << std::setw(22) << "identifiers";
+			PrintDistribution(entry.mName, hashes);
+			std::cout << std::endl;
+
+			for (std::uint32_t key = 0; key < KeyCount; ++key)
+			{
+				hashes[key] = entry.mHash(data.data() + key, 48U);
+			}
+			std::cout << std::setw(22) << "shifted 48 byte keys";
+			PrintDistribution(entry.mName, hashes);
+			std::cout << std::endl;
+		}
+		{
+			for (std::uint32_t key = 0; key < KeyCount; ++key)
+			{
+				hashes[key] = HashFunctions::MixInteger(key);
+			}
+			std::cout << std::setw(22) << "sequential integers";
+			PrintDistribution("MixInteger", hashes);
+			std::cout << std::endl;
+		}
+
+		std::cout << std::endl << "Worst avalanche bias (0 is ideal, 0.5 is a hash bit which ignores a key bit)" << std::endl;
+		std::cout << std::setw(8) << "Length";
+		for (const auto& entry : Hashes)
+		{
+			std::cout << std::setw(16) << entry.mName;
+		}
+		std::cout << std::endl;
+		const std::uint32_t avalancheLengths[] = { 4, 16, 48 };
+		for (std::uint32_t length : avalancheLengths)
+		{
+			std::cout << std::setw(8) << length;
+			for (const auto& entry : Hashes)
+			{
+				std::cout << std::setw(16) << std::setprecision(3) << AvalancheBias(entry.mHash, length, random);
+			}
+			std::cout << std::endl;
+		}
+
+		if (sSink == 0)
+		{
+			std::cout << std::endl;
+		}
+	}
+}
@@ -0,0 +1,76 @@
+#include "Pch.h"
+#include <atomic>
+#include <iomanip>
+#include "Benchmarks.h"
+#include "JobSystem.h"
+
+using namespace AnonymousEngine::Core;
+using namespace std::chrono;
+
+namespace Benchmark
+{
+	// Number of indices processed by one run
+	static const std::uint32_t ElementCount = 1U << 20;
+	// Amount of work done per index
+	static const std::uint32_t RoundsPerElement = 64U;
+	// Runs averaged for every thread count
+	static const std::uint32_t RunCount = 5U;
+
+	// Some work the optimizer can't throw away
+	static std::uint64_t Work(std::uint32_t begin, std::uint32_t end)
+	{
+		std::uint64_t result = 0;
+		for (std::uint32_t index = begin; index < end; ++index)
+		{
+			std::uint64_t value = index;
+			for (std::uint32_t round = 0; round < RoundsPerElement; ++round)
+			{
+				value ^= value >> 33;
+				value *= 0xff51afd7ed558ccdULL;
+				value ^= value >> 29;
+			}
+			result += value;
+		}
+		return result;
+	}
+
+	void RunJobSystemBenchmark()
+	{
+		std::uint32_t threadCount = JobSystem::DefaultWorkerCount() + 1;
+		std::uint64_t expected = Work(0, ElementCount);
+		double baseline = 0.0;
+
+		std::cout << "Job system scaling: " << ElementCount << " elements, " << RoundsPerElement << " rounds each" << std::endl;
+		std::cout << std::setw(8) << "Threads" << std::setw(12) << "Time (ms)" << std::setw(10) << "Speedup" << std::setw(12) << "Efficiency" << std::endl;
+
+		for (std::uint32_t threads = 1; threads <= threadCount; ++threads)
+		{
+			JobSystem jobSystem(threads - 1);
+			std::atomic<std::uint64_t> result(0);
+			auto body = [&result](std::uint32_t begin, std::uint32_t end) { result += Work(begin, end); };
+
+			// warm up the workers before measuring
+			jobSystem.ParallelFor(0, ElementCount, body);
+
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for (std::uint32_t run = 0; run < RunCount; ++run)
+			{
+				jobSystem.ParallelFor(0, ElementCount, body);
+			}
+			double milliseconds = duration_cast<duration<double, std::milli>>(high_resolution_clock::now() - start).count() / RunCount;
+
+			if (result.load() != expected * (RunCount + 1))
+			{
+				std::cerr << "Parallel result does not match the serial result with " << threads << " threads" << std::endl;
+			}
+
+			if (threads == 1)
+			{
+				baseline = milliseconds;
+			}
+			double speedup = baseline / milliseconds;
+			std::cout << std::setw(8) << threads << std::setw(12) << std::fixed << std::setprecision(2) << milliseconds
+				<< std::setw(10) << speedup << std::setw(11) << (speedup * 100.0 / threads) << "%" << std::endl;
+		}
+	}
+}
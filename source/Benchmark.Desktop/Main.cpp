@@ -0,0 +1,44 @@
+#include "Pch.h"
+#include "Benchmarks.h"
+
+// A benchmark which can be selected from the command line
+struct BenchmarkEntry
+{
+	const char* mName;
+	void (*mRun)();
+};
+
+static const BenchmarkEntry Benchmarks[] =
+{
+	{ "jobs", Benchmark::RunJobSystemBenchmark },
+	{ "hash", Benchmark::RunHashBenchmark }
+};
+
+/** Runs the engine micro benchmarks.
+ *  Usage: Benchmark.Desktop [benchmark name]. Runs every benchmark when no name is given
+ */
+int main(int argc, char* argv[])
+{
+	bool found = false;
+	for (const auto& benchmark : Benchmarks)
+	{
+		if (argc < 2 || std::string(argv[1]) == benchmark.mName)
+		{
+			benchmark.mRun();
+			std::cout << std::endl;
+			found = true;
+		}
+	}
+
+	if (!found)
+	{
+		std::cerr << "Unknown benchmark " << argv[1] << ". Available benchmarks:";
+		for (const auto& benchmark : Benchmarks)
+		{
+			std::cerr << " " << benchmark.mName;
+		}
+		std::cerr << std::endl;
+		return 1;
+	}
+	return 0;
+}
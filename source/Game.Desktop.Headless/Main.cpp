@@ -0,0 +1,62 @@
+#include "Pch.h"
+#include "ActionList.h"
+#include "CreateAction.h"
+#include "DestroyAction.h"
+#include "Entity.h"
+#include "EventQueue.h"
+#include "HeadlessSimulation.h"
+#include "SetValue.h"
+#include "Switch.h"
+#include "World.h"
+
+#define DEFAULT_TICK_COUNT	10000
+#define DEFAULT_STEP		16
+
+using namespace AnonymousEngine;
+
+/** Runs a world xml without a window or renderer, as fast as the CPU allows, and reports the tick rate.
+ *  Usage: Game.Desktop.Headless <world xml> [tick count] [step in milliseconds]
+ */
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " <world xml> [tick count] [step in milliseconds]" << std::endl;
+		return 1;
+	}
+
+	std::uint64_t ticks = (argc > 2) ? std::stoull(argv[2]) : DEFAULT_TICK_COUNT;
+	std::chrono::milliseconds step((argc > 3) ? std::stoll(argv[3]) : DEFAULT_STEP);
+
+	// Factories for every type the world xml can instantiate
+	Containers::EntityFactory entityFactory;
+	Containers::ActionListFactory actionListFactory;
+	Containers::CreateActionFactory createActionFactory;
+	Containers::DestroyActionFactory destroyActionFactory;
+	Containers::SetValueFactory setValueFactory;
+	Containers::SwitchFactory switchFactory;
+
+	Containers::World* world = nullptr;
+	try
+	{
+		world = Containers::HeadlessSimulation::LoadWorld(argv[1]);
+		Core::EventQueue eventQueue;
+		Containers::HeadlessSimulation simulation(*world, eventQueue, step);
+		simulation.Run(ticks);
+
+		std::cout << "World:          " << world->Name() << std::endl;
+		std::cout << "Ticks:          " << simulation.Ticks() << std::endl;
+		std::cout << "Simulated time: " << simulation.SimulatedTime().count() << " ms" << std::endl;
+		std::cout << "Wall time:      " << std::chrono::duration_cast<std::chrono::milliseconds>(simulation.WallTime()).count() << " ms" << std::endl;
+		std::cout << "Ticks/second:   " << simulation.TicksPerSecond() << std::endl;
+	}
+	catch (const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		delete world;
+		return 1;
+	}
+
+	delete world;
+	return 0;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// Windows headers
+#include <SDKDDKVer.h>
+
+// Standard library headers
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <string>
@@ -7,6 +7,7 @@ namespace AnonymousEngine
 		ATTRIBUTED_DEFINITIONS(Action)
 
 		const std::string Action::ActionsAttributeName = "Actions";
+		const HashedName Action::ActionsAttributeKey("Actions");
 
 		Action::Action(const std::string& name) :
 			mName(name)
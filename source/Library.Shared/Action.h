@@ -43,6 +43,9 @@ namespace AnonymousEngine
 			/** The prescribed attribute name used in the world, sector, entity hierrarchy to store the list of actions
 			 */
 			static const std::string ActionsAttributeName;
+			/** The name of the actions attribute, hashed at compile time for lookups
+			 */
+			static const HashedName ActionsAttributeKey;
 
 		protected:
 			/** The name of this action
@@ -1,4 +1,5 @@
 #include "Attributed.h"
+#include "ConcurrentHashMap.h"
 #include "Datum.h"
 
 namespace AnonymousEngine
@@ -7,6 +8,9 @@ namespace AnonymousEngine
 
 	const std::uint32_t Attributed::sPrescribedAttributeCount = InitializePrescribedAttributeNames();
 
+	// The attribute every attributed scope points to itself with
+	static constexpr HashedName ThisAttributeKey("this");
+
 	Attributed::Attributed() :
 		mPrescribedAttributesAdded(0U)
 	{
@@ -80,7 +84,7 @@ namespace AnonymousEngine
 
 	bool Attributed::IsPrescribedAttribute(const std::string& name) const
 	{
-		auto prescribedAttributes = PrescribedAttributesNamesCache(TypeIdInstance());
+		const auto& prescribedAttributes = PrescribedAttributesNames(TypeIdInstance());
 		return prescribedAttributes.Find(name) != prescribedAttributes.end();
 	}
 
@@ -96,13 +100,13 @@ namespace AnonymousEngine
 
 	const Vector<std::string>& Attributed::PrescribedAttributes() const
 	{
-		return PrescribedAttributesNamesCache(TypeIdInstance());
+		return PrescribedAttributesNames(TypeIdInstance());
 	}
 
 	void Attributed::AuxiliaryAttributes(Vector<std::string>& auxiliaryAttributes) const
 	{
 		auxiliaryAttributes.Clear();
-		const auto& prescribedAttributes = PrescribedAttributesNamesCache(TypeIdInstance());
+		const auto& prescribedAttributes = PrescribedAttributesNames(TypeIdInstance());
 		for (const auto& pair : mOrderVector)
 		{
 			if (prescribedAttributes.Find(pair->first) == prescribedAttributes.end())
@@ -196,16 +200,33 @@ namespace AnonymousEngine
 
 	void Attributed::ValidateAllPrescribedAttributesAreAdded() const
 	{
-		if (mPrescribedAttributesAdded < PrescribedAttributesNamesCache(TypeIdInstance()).Size())
+		if (mPrescribedAttributesAdded < PrescribedAttributesNames(TypeIdInstance()).Size())
 		{
 			throw std::runtime_error("All the prescribed attributes are not added.");
 		}
 	}
 
+	// Filled in by the static initialization of every attributed class and only read afterwards, from any thread
+	static ConcurrentHashMap<std::uint64_t, Vector<std::string>>& PrescribedAttributesMap()
+	{
+		static ConcurrentHashMap<std::uint64_t, Vector<std::string>> sPrescribedAttributes;
+		return sPrescribedAttributes;
+	}
+
 	Vector<std::string>& Attributed::PrescribedAttributesNamesCache(std::uint64_t typeId)
 	{
-		static HashMap<std::uint64_t, Vector<std::string>> sPrescribedAttributes;
-		return sPrescribedAttributes[typeId];
+		return PrescribedAttributesMap()[typeId];
+	}
+
+	const Vector<std::string>& Attributed::PrescribedAttributesNames(std::uint64_t typeId)
+	{
+		// instances are built on worker threads, such as by the parallel world loader, so they must never insert
+		const Vector<std::string>* prescribedAttributes = PrescribedAttributesMap().Find(typeId);
+		if (prescribedAttributes == nullptr)
+		{
+			throw std::runtime_error("The prescribed attributes of the type are not registered.");
+		}
+		return *prescribedAttributes;
 	}
 
 	void Attributed::AppendPrescribedAttributeNames(Vector<std::string>& prescribedAttributeNames)
@@ -216,13 +237,13 @@ namespace AnonymousEngine
 	void Attributed::Copy(const Attributed& rhs)
 	{
 		mPrescribedAttributesAdded = rhs.mPrescribedAttributesAdded;
-		(*this)["this"] = this;
+		(*this)[ThisAttributeKey] = this;
 	}
 
 	void Attributed::Move(Attributed& rhs)
 	{
 		mPrescribedAttributesAdded = rhs.mPrescribedAttributesAdded;
-		(*this)["this"] = this;
+		(*this)[ThisAttributeKey] = this;
 	}
 
 	template <typename T>
@@ -251,7 +272,7 @@ namespace AnonymousEngine
 	void Attributed::ValidateAttribute(const std::string& name)
 	{
 		// Check if all prescribed attributes are added. 
-		auto& prescribedAttributes = PrescribedAttributesNamesCache(TypeIdInstance());
+		const auto& prescribedAttributes = PrescribedAttributesNames(TypeIdInstance());
 		if (mPrescribedAttributesAdded < prescribedAttributes.Size())
 		{
 			// Since all prescribed attributes are not added, verify that the new attribute being added
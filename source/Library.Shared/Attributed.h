@@ -177,7 +177,8 @@ namespace AnonymousEngine
 		 */
 		void ValidateAllPrescribedAttributesAreAdded() const;
 
-		/** Returns a reference to the vector which stores the list of all prescribed attributes
+		/** Returns a reference to the vector which stores the list of all prescribed attributes, adding it if the class
+		 *  has none yet. Only meant for the static initialization of the attributed classes
 		*/
 		static Vector<std::string>& PrescribedAttributesNamesCache(std::uint64_t typeId);
 
@@ -213,6 +214,10 @@ namespace AnonymousEngine
 		// Checks if attribute being added is a valid prescribed attribute
 		void ValidateAttribute(const std::string& name);
 
+		// Returns the prescribed attribute names of a class registered during static initialization, without inserting.
+		// Throws std::runtime_error if the class never registered them
+		static const Vector<std::string>& PrescribedAttributesNames(std::uint64_t typeId);
+
 		// Appendss all prescribed names of the class to the static hashmap
 		// Each of the descendants of attributed redefines this method(part of the attributed macros)
 		static std::uint32_t InitializePrescribedAttributeNames();
@@ -0,0 +1,445 @@
+#include "BinaryWorldReader.h"
+#include <cstring>
+#include "Action.h"
+#include "BinaryWorldWriter.h"
+#include "Datum.h"
+#include "Entity.h"
+#include "MemoryMappedFile.h"
+#include "Sector.h"
+#include "World.h"
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		using namespace AnonymousEngine::Containers;
+
+		BinaryWorldReader::BinaryWorldReader() :
+			mCreators(), mData(nullptr), mSize(0), mPosition(0), mIsAligned(false), mInPlace(false), mIsDelta(false), mStrings(), mTypes(), mTypeNames()
+		{
+			RegisterType(Scope::TypeName(), []() { return new Scope(); });
+			RegisterType(World::TypeName(), []() { return new World(std::string()); });
+			RegisterType(Sector::TypeName(), []() { return new Sector(std::string()); });
+		}
+
+		void BinaryWorldReader::RegisterType(const std::string& typeName, const ScopeCreator& creator)
+		{
+			mCreators[typeName] = creator;
+		}
+
+		Scope* BinaryWorldReader::LoadFromFile(const std::string& filename)
+		{
+			MemoryMappedFile file(filename);
+			return Load(file.Data(), file.Size(), false);
+		}
+
+		Scope* BinaryWorldReader::Load(const std::string& data)
+		{
+			return Load(data.c_str(), data.size(), false);
+		}
+
+		Scope* BinaryWorldReader::LoadInPlace(char* data, std::uint64_t size)
+		{
+			return Load(data, size, true);
+		}
+
+		void BinaryWorldReader::ApplyDeltaFromFile(Scope& root, const std::string& filename)
+		{
+			MemoryMappedFile file(filename);
+			ApplyDelta(root, file.Data(), file.Size());
+		}
+
+		void BinaryWorldReader::ApplyDelta(Scope& root, const std::string& data)
+		{
+			ApplyDelta(root, data.c_str(), data.size());
+		}
+
+		World* BinaryWorldReader::LoadWorldFromFile(const std::string& filename)
+		{
+			Scope* root = LoadFromFile(filename);
+			if (!root->Is<World>())
+			{
+				delete root;
+				throw std::runtime_error(std::string("Binary world file doesn't hold a world. filename = ").append(filename));
+			}
+			return static_cast<World*>(root);
+		}
+
+		const char* BinaryWorldReader::ReadBytes(std::uint64_t size)
+		{
+			if (size > mSize - mPosition)
+			{
+				throw std::runtime_error("Binary world is truncated.");
+			}
+			const char* bytes = mData + mPosition;
+			mPosition += size;
+			return bytes;
+		}
+
+		template <typename T>
+		T BinaryWorldReader::ReadValue()
+		{
+			T value;
+			std::memcpy(&value, ReadBytes(sizeof(T)), sizeof(T));
+			return value;
+		}
+
+		void BinaryWorldReader::ResizeDatum(Datum& datum, const std::string& key, std::uint32_t size)
+		{
+			// prescribed attributes point at members, those are written in place and can't be resized
+			if (!datum.IsExternal())
+			{
+				datum.Resize(size);
+			}
+			else if (datum.Size() != size)
+			{
+				throw std::runtime_error(std::string("Binary world datum size doesn't match the prescribed attribute. key = ").append(key));
+			}
+		}
+
+		void BinaryWorldReader::SkipPadding()
+		{
+			if (mIsAligned)
+			{
+				ReadBytes((BinaryWorldWriter::PayloadAlignment - mPosition % BinaryWorldWriter::PayloadAlignment) % BinaryWorldWriter::PayloadAlignment);
+			}
+		}
+
+		template <typename T>
+		void BinaryWorldReader::ReadBlock(Datum& datum, const std::string& key, std::uint32_t size)
+		{
+			SkipPadding();
+			const char* block = ReadBytes(sizeof(T) * static_cast<std::uint64_t>(size));
+			if (mInPlace && !datum.IsExternal())
+			{
+				// the caller guarantees the data is writable and outlives the datum
+				datum.SetStorage(reinterpret_cast<T*>(const_cast<char*>(block)), size);
+				return;
+			}
+			ResizeDatum(datum, key, size);
+			std::memcpy(&datum.Get<T>(), block, sizeof(T) * size);
+		}
+
+		Scope* BinaryWorldReader::Load(const char* data, std::uint64_t size, bool inPlace)
+		{
+			Scope* root = nullptr;
+			try
+			{
+				ReadHeader(data, size, inPlace, false);
+				root = ReadScope();
+				if (mPosition != mSize)
+				{
+					throw std::runtime_error("Binary world has trailing data.");
+				}
+			}
+			catch (...)
+			{
+				delete root;
+				EndRead();
+				throw;
+			}
+
+			EndRead();
+			return root;
+		}
+
+		void BinaryWorldReader::ApplyDelta(Scope& root, const char* data, std::uint64_t size)
+		{
+			try
+			{
+				ReadHeader(data, size, false, true);
+				std::uint32_t recordCount = ReadValue<std::uint32_t>();
+				for (std::uint32_t index = 0; index < recordCount; ++index)
+				{
+					// walk down the path of keys and indices to the scope holding the changed datum
+					Scope* scope = &root;
+					std::uint32_t depth = ReadValue<std::uint32_t>();
+					for (std::uint32_t step = 0; step < depth; ++step)
+					{
+						const std::string& key = ReadString();
+						std::uint32_t valueIndex = ReadValue<std::uint32_t>();
+						Datum* datum = scope->Find(key);
+						if (datum == nullptr || datum->Type() != Datum::DatumType::Scope || valueIndex >= datum->Size())
+						{
+							throw std::runtime_error(std::string("Binary world delta doesn't fit the scope it is applied to. key = ").append(key));
+						}
+						scope = &datum->Get<Scope>(valueIndex);
+					}
+					std::uint8_t kind = ReadValue<std::uint8_t>();
+					if (kind == BinaryWorldWriter::ReplaceRecord)
+					{
+						ReadDatum(*scope);
+					}
+					else if (kind == BinaryWorldWriter::AppendRecord)
+					{
+						AppendScopes(*scope);
+					}
+					else
+					{
+						throw std::runtime_error("Binary world delta has an invalid record kind.");
+					}
+				}
+				if (mPosition != mSize)
+				{
+					throw std::runtime_error("Binary world has trailing data.");
+				}
+			}
+			catch (...)
+			{
+				EndRead();
+				throw;
+			}
+			EndRead();
+		}
+
+		void BinaryWorldReader::ReadHeader(const char* data, std::uint64_t size, bool inPlace, bool isDelta)
+		{
+			mData = data;
+			mSize = size;
+			mPosition = 0;
+			mIsAligned = false;
+			mInPlace = inPlace;
+			mIsDelta = isDelta;
+			mStrings.Clear();
+			mTypes.Clear();
+			mTypeNames.Clear();
+
+			if (size < sizeof(BinaryWorldWriter::Magic) || std::memcmp(ReadBytes(sizeof(BinaryWorldWriter::Magic)), BinaryWorldWriter::Magic, sizeof(BinaryWorldWriter::Magic)) != 0)
+			{
+				throw std::runtime_error("Data is not a binary world.");
+			}
+			if (ReadValue<std::uint32_t>() != BinaryWorldWriter::Version)
+			{
+				throw std::runtime_error("Unsupported binary world version.");
+			}
+			std::uint32_t flags = ReadValue<std::uint32_t>();
+			mIsAligned = (flags & BinaryWorldWriter::AlignedPayloadsFlag) != 0;
+			if (mInPlace && !mIsAligned)
+			{
+				throw std::runtime_error("Binary world is not aligned and can't be used in place.");
+			}
+			if (((flags & BinaryWorldWriter::DeltaFlag) != 0) != mIsDelta)
+			{
+				throw std::runtime_error(mIsDelta ? "Binary world is not a delta." : "Binary world is a delta and can only be applied to a scope.");
+			}
+
+			std::uint32_t stringCount = ReadValue<std::uint32_t>();
+			mStrings.Reserve(stringCount);
+			for (std::uint32_t index = 0; index < stringCount; ++index)
+			{
+				std::uint32_t length = ReadValue<std::uint32_t>();
+				mStrings.PushBack(std::string(ReadBytes(length), length));
+			}
+
+			// resolve every type once, not once per scope
+			std::uint32_t typeCount = ReadValue<std::uint32_t>();
+			mTypes.Reserve(typeCount);
+			mTypeNames.Reserve(typeCount);
+			for (std::uint32_t index = 0; index < typeCount; ++index)
+			{
+				const std::string& typeName = ReadString();
+				mTypes.PushBack(FindCreator(typeName));
+				mTypeNames.PushBack(&typeName);
+			}
+			SkipPadding();
+		}
+
+		void BinaryWorldReader::EndRead()
+		{
+			mData = nullptr;
+			mStrings.Clear();
+			mTypes.Clear();
+			mTypeNames.Clear();
+		}
+
+		std::uint32_t BinaryWorldReader::ReadTypeIndex()
+		{
+			std::uint32_t typeIndex = ReadValue<std::uint32_t>();
+			if (typeIndex >= mTypes.Size())
+			{
+				throw std::runtime_error("Binary world has an invalid type index.");
+			}
+			return typeIndex;
+		}
+
+		Scope* BinaryWorldReader::ReadScope()
+		{
+			Scope* scope = mTypes[ReadTypeIndex()]();
+			try
+			{
+				ReadDatums(*scope);
+			}
+			catch (...)
+			{
+				delete scope;
+				throw;
+			}
+			return scope;
+		}
+
+		std::uint32_t BinaryWorldReader::ReadDatums(Scope& scope)
+		{
+			std::uint32_t datumCount = ReadValue<std::uint32_t>();
+			for (std::uint32_t index = 0; index < datumCount; ++index)
+			{
+				ReadDatum(scope);
+			}
+			return datumCount;
+		}
+
+		void BinaryWorldReader::ReadDatum(Scope& scope)
+		{
+			const std::string& key = ReadString();
+			std::uint8_t typeValue = ReadValue<std::uint8_t>();
+			std::uint32_t size = ReadValue<std::uint32_t>();
+			if (typeValue >= static_cast<std::uint8_t>(Datum::DatumType::MaxTypes))
+			{
+				throw std::runtime_error("Binary world has an invalid datum type.");
+			}
+			Datum::DatumType type = static_cast<Datum::DatumType>(typeValue);
+
+			Datum& datum = scope.Append(key);
+			if (type == Datum::DatumType::Unknown)
+			{
+				return;
+			}
+			if (datum.Type() == Datum::DatumType::Unknown)
+			{
+				datum.SetType(type);
+			}
+			else if (datum.Type() != type)
+			{
+				throw std::runtime_error(std::string("Binary world datum type doesn't match the prescribed attribute. key = ").append(key));
+			}
+
+			if (type == Datum::DatumType::Scope)
+			{
+				// nested scopes created by a constructor are filled in place, the rest are created and adopted
+				std::uint32_t existingCount = datum.Size();
+				for (std::uint32_t index = 0; index < size; ++index)
+				{
+					if (index < existingCount)
+					{
+						std::uint64_t childPosition = mPosition;
+						std::uint32_t typeIndex = ReadTypeIndex();
+						Scope& child = datum.Get<Scope>(index);
+						if (!mIsDelta || child.TypeNameInstance() == *mTypeNames[typeIndex])
+						{
+							// a delta holds the whole child, so one left with datums the record doesn't have is replaced
+							std::uint32_t datumCount = ReadDatums(child);
+							if (!mIsDelta || child.Size() == datumCount)
+							{
+								continue;
+							}
+						}
+
+						// a delta replaces the children from the first one it doesn't fit onwards
+						RemoveChildren(datum, index);
+						existingCount = index;
+						// the child record is read again into a new scope
+						mPosition = childPosition;
+					}
+					scope.Adopt(*ReadScope(), key);
+				}
+				if (mIsDelta && size < datum.Size())
+				{
+					RemoveChildren(datum, size);
+				}
+				return;
+			}
+			if (type == Datum::DatumType::RTTI)
+			{
+				// pointers are not stored, a prescribed pointer keeps what its owner set it to
+				return;
+			}
+
+			if (size == 0)
+			{
+				ResizeDatum(datum, key, size);
+				return;
+			}
+
+			switch (type)
+			{
+			case Datum::DatumType::Integer:
+				ReadBlock<std::int32_t>(datum, key, size);
+				break;
+			case Datum::DatumType::Float:
+				ReadBlock<float>(datum, key, size);
+				break;
+			case Datum::DatumType::Vector:
+				ReadBlock<glm::vec4>(datum, key, size);
+				break;
+			case Datum::DatumType::Matrix:
+				ReadBlock<glm::mat4>(datum, key, size);
+				break;
+			case Datum::DatumType::String:
+				ResizeDatum(datum, key, size);
+				for (std::uint32_t index = 0; index < size; ++index)
+				{
+					datum.Set(ReadString(), index);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		void BinaryWorldReader::AppendScopes(Scope& scope)
+		{
+			const std::string& key = ReadString();
+			std::uint8_t typeValue = ReadValue<std::uint8_t>();
+			std::uint32_t size = ReadValue<std::uint32_t>();
+			const Datum* datum = scope.Find(key);
+			if (typeValue != static_cast<std::uint8_t>(Datum::DatumType::Scope) || (datum != nullptr && datum->Type() != Datum::DatumType::Unknown && datum->Type() != Datum::DatumType::Scope))
+			{
+				throw std::runtime_error(std::string("Binary world delta appends scopes to a datum of another type. key = ").append(key));
+			}
+			for (std::uint32_t index = 0; index < size; ++index)
+			{
+				scope.Adopt(*ReadScope(), key);
+			}
+		}
+
+		void BinaryWorldReader::RemoveChildren(Datum& datum, std::uint32_t first)
+		{
+			while (datum.Size() > first)
+			{
+				Scope* child = &datum.Get<Scope>(datum.Size() - 1);
+				child->Orphan();
+				delete child;
+			}
+		}
+
+		const std::string& BinaryWorldReader::ReadString()
+		{
+			std::uint32_t index = ReadValue<std::uint32_t>();
+			if (index >= mStrings.Size())
+			{
+				throw std::runtime_error("Binary world has an invalid string index.");
+			}
+			return mStrings[index];
+		}
+
+		BinaryWorldReader::ScopeCreator BinaryWorldReader::FindCreator(const std::string& typeName) const
+		{
+			auto it = mCreators.Find(typeName);
+			if (it != mCreators.end())
+			{
+				return it->second;
+			}
+
+			Factory<Entity>* entityFactory = Factory<Entity>::Find(typeName);
+			if (entityFactory != nullptr)
+			{
+				return [entityFactory]() { return entityFactory->Create(); };
+			}
+			Factory<Action>* actionFactory = Factory<Action>::Find(typeName);
+			if (actionFactory != nullptr)
+			{
+				return [actionFactory]() { return actionFactory->Create(); };
+			}
+			throw std::runtime_error(std::string("No creator or factory for binary world type. type = ").append(typeName));
+		}
+	}
+}
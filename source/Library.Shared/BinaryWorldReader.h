@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "HashMap.h"
+#include "Scope.h"
+#include "Vector.h"
+
+namespace AnonymousEngine
+{
+	namespace Containers
+	{
+		class World;
+	}
+
+	namespace Parsers
+	{
+		/** Reads scope hierarchies written by BinaryWorldWriter. Every type name in the type table is resolved to a
+		 *  creator once per load instead of once per scope, numeric datums are copied into place with a single memcpy
+		 *  and strings are built once from the string table.
+		 *
+		 *  Scope, World and Sector are known to every reader, other types are created through the Entity and Action
+		 *  factories and any other scope class can be added with RegisterType. Prescribed attributes and nested scopes
+		 *  of the created scopes are filled in place, so external storage keeps pointing at the members of the objects
+		 */
+		class BinaryWorldReader final
+		{
+		public:
+			typedef std::function<Scope*()> ScopeCreator;
+
+			/** Initialize a reader which knows the built in scope types
+			 */
+			BinaryWorldReader();
+			/** Free up allocated resources
+			 */
+			~BinaryWorldReader() = default;
+
+			// Delete move and copy semantics
+			BinaryWorldReader(const BinaryWorldReader&) = delete;
+			BinaryWorldReader& operator=(const BinaryWorldReader&) = delete;
+
+			/** Teach the reader how to create a scope type which the factories don't know about
+			 *  @param typeName The RTTI type name of the class
+			 *  @param creator Creates a new default instance of the class
+			 */
+			void RegisterType(const std::string& typeName, const ScopeCreator& creator);
+
+			/** Load a scope hierarchy from a file. The file is mapped into memory instead of being read into a buffer
+			 *  @param filename The name of the binary world file
+			 *  @return The root scope. The caller takes ownership of it
+			 *  @exception std::runtime_error Thrown if the file can't be read, is not a binary world or is corrupt
+			 */
+			Scope* LoadFromFile(const std::string& filename);
+			/** Load a scope hierarchy from a buffer holding a binary world
+			 *  @param data The binary world
+			 *  @return The root scope. The caller takes ownership of it
+			 *  @exception std::runtime_error Thrown if the data is not a binary world or is corrupt
+			 */
+			Scope* Load(const std::string& data);
+			/** Load a world from a file
+			 *  @param filename The name of the binary world file
+			 *  @return The loaded world. The caller takes ownership of it
+			 *  @exception std::runtime_error Thrown if the file can't be loaded or its root is not a world
+			 */
+			Containers::World* LoadWorldFromFile(const std::string& filename);
+			/** Load a scope hierarchy from an aligned binary world without copying its numeric blocks. The datums which
+			 *  aren't prescribed attributes use the blocks as external storage, strings and scopes are still built
+			 *  @param data The binary world, written with aligned payloads. It has to outlive the hierarchy and has to be
+			 *  writable for as long as its datums can be written to
+			 *  @param size The number of bytes in the binary world
+			 *  @return The root scope. The caller takes ownership of it
+			 *  @exception std::runtime_error Thrown if the data is not an aligned binary world or is corrupt
+			 */
+			Scope* LoadInPlace(char* data, std::uint64_t size);
+			/** Apply a delta written by BinaryWorldWriter::WriteDelta to the scope hierarchy it was written from, or to a
+			 *  copy of it loaded from the checkpoint the delta is relative to. Changed datums are replaced and new nested
+			 *  scopes are appended. Replaced lists of nested scopes keep the children whose type matches and replace or
+			 *  remove the rest
+			 *  @param root The scope to update
+			 *  @param data The delta
+			 *  @exception std::runtime_error Thrown if the data is not a delta, is corrupt or doesn't fit the hierarchy
+			 */
+			void ApplyDelta(Scope& root, const std::string& data);
+			/** Apply a delta file written by BinaryWorldWriter::WriteDeltaToFile to a scope hierarchy
+			 *  @param root The scope to update
+			 *  @param filename The name of the delta file
+			 *  @exception std::runtime_error Thrown if the file can't be read, is not a delta, is corrupt or doesn't fit
+			 *  the hierarchy
+			 */
+			void ApplyDeltaFromFile(Scope& root, const std::string& filename);
+		private:
+			// Load a binary world from memory, copying numeric blocks or using them in place
+			Scope* Load(const char* data, std::uint64_t size, bool inPlace);
+			// Apply a delta from memory
+			void ApplyDelta(Scope& root, const char* data, std::uint64_t size);
+			// Start reading data, consuming the header and the tables
+			void ReadHeader(const char* data, std::uint64_t size, bool inPlace, bool isDelta);
+			// Forget the data once it is read
+			void EndRead();
+			// Adopt the scopes of the next append record of a delta
+			void AppendScopes(Scope& scope);
+			// Orphan and delete the nested scopes of a datum from an index onwards
+			static void RemoveChildren(Datum& datum, std::uint32_t first);
+			// Read a scope record and everything under it
+			Scope* ReadScope();
+			// Read the datums of a scope record into a scope, returning how many the record had
+			std::uint32_t ReadDatums(Scope& scope);
+			// Consume a type table index
+			std::uint32_t ReadTypeIndex();
+			// Fill a datum of a scope from the next datum record
+			void ReadDatum(Scope& scope);
+			// Size a datum for the values of a record, prescribed attributes have to match instead
+			void ResizeDatum(Datum& datum, const std::string& key, std::uint32_t size);
+			// Fill a numeric datum from the next block of the data
+			template <typename T>
+			void ReadBlock(Datum& datum, const std::string& key, std::uint32_t size);
+			// Skip the padding before an aligned numeric block
+			void SkipPadding();
+			// Consume the next bytes of the data
+			const char* ReadBytes(std::uint64_t size);
+			// Consume a plain value
+			template <typename T>
+			T ReadValue();
+			// Consume a string table index and return the string
+			const std::string& ReadString();
+			// Find how to create a type named in the type table
+			ScopeCreator FindCreator(const std::string& typeName) const;
+
+			// Creators of the types which are not made through factories
+			HashMap<std::string, ScopeCreator> mCreators;
+
+			// The data being loaded and the read position in it
+			const char* mData;
+			std::uint64_t mSize;
+			std::uint64_t mPosition;
+			// Whether numeric blocks of the data are aligned, and whether they are used in place
+			bool mIsAligned;
+			bool mInPlace;
+			// Whether the data is a delta
+			bool mIsDelta;
+			// The string and type tables of the data being loaded
+			Vector<std::string> mStrings;
+			Vector<ScopeCreator> mTypes;
+			Vector<const std::string*> mTypeNames;
+		};
+	}
+}
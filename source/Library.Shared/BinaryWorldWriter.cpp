@@ -0,0 +1,401 @@
+#include "BinaryWorldWriter.h"
+#include <fstream>
+#include <limits>
+#include "Datum.h"
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		const char BinaryWorldWriter::Magic[4] = { 'A', 'E', 'W', 'B' };
+		const std::uint32_t BinaryWorldWriter::Version = 2U;
+		const std::uint32_t BinaryWorldWriter::AlignedPayloadsFlag = 1U;
+		const std::uint32_t BinaryWorldWriter::PayloadAlignment = 16U;
+		const std::uint32_t BinaryWorldWriter::DeltaFlag = 2U;
+		const std::uint8_t BinaryWorldWriter::ReplaceRecord = 0U;
+		const std::uint8_t BinaryWorldWriter::AppendRecord = 1U;
+
+		BinaryWorldWriter::BinaryWorldWriter(bool alignPayloads) :
+			mAlignPayloads(alignPayloads), mIsAligningBody(false), mStrings(), mStringIndices(), mTypes(), mTypeIndices(), mBody(),
+			mPath(), mRecordCount(0), mStates(), mNextStates()
+		{
+		}
+
+		void BinaryWorldWriter::Write(const Scope& root, std::ostream& out)
+		{
+			Reset(mAlignPayloads);
+			WriteScope(root);
+			Output(out, mAlignPayloads ? AlignedPayloadsFlag : 0U);
+		}
+
+		void BinaryWorldWriter::Checkpoint(Scope& root)
+		{
+			mNextStates.Clear();
+			ClearChanges(root);
+			std::swap(mStates, mNextStates);
+		}
+
+		void BinaryWorldWriter::WriteDelta(Scope& root, std::ostream& out)
+		{
+			// deltas are applied by copying, so their blocks are never aligned
+			Reset(false);
+			mPath.Clear();
+			mRecordCount = 0;
+			mNextStates.Clear();
+			WriteChanges(root);
+
+			// hashes of datums which no longer exist are dropped along the way
+			std::swap(mStates, mNextStates);
+			Output(out, DeltaFlag);
+		}
+
+		void BinaryWorldWriter::WriteDeltaToFile(Scope& root, const std::string& filename)
+		{
+			std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+			if (!out.is_open())
+			{
+				throw std::runtime_error(std::string("Unable to create binary world delta file. filename = ").append(filename));
+			}
+			WriteDelta(root, out);
+		}
+
+		void BinaryWorldWriter::Reset(bool alignBody)
+		{
+			mIsAligningBody = alignBody;
+			mStrings.Clear();
+			mStringIndices.Clear();
+			mTypes.Clear();
+			mTypeIndices.Clear();
+			mBody.clear();
+		}
+
+		void BinaryWorldWriter::Output(std::ostream& out, std::uint32_t flags)
+		{
+			// the tables are only complete once the body is written, so the body is buffered and goes out last
+			std::string tables;
+			tables.append(Magic, sizeof(Magic));
+			tables.append(reinterpret_cast<const char*>(&Version), sizeof(Version));
+			tables.append(reinterpret_cast<const char*>(&flags), sizeof(flags));
+			std::uint32_t stringCount = mStrings.Size();
+			tables.append(reinterpret_cast<const char*>(&stringCount), sizeof(stringCount));
+			for (const auto& value : mStrings)
+			{
+				std::uint32_t length = static_cast<std::uint32_t>(value.size());
+				tables.append(reinterpret_cast<const char*>(&length), sizeof(length)).append(value);
+			}
+			std::uint32_t typeCount = mTypes.Size();
+			tables.append(reinterpret_cast<const char*>(&typeCount), sizeof(typeCount));
+			for (const auto& nameIndex : mTypes)
+			{
+				tables.append(reinterpret_cast<const char*>(&nameIndex), sizeof(nameIndex));
+			}
+			// the body is aligned relative to its own start, so it has to start aligned in the file
+			if (mIsAligningBody)
+			{
+				tables.append((PayloadAlignment - tables.size() % PayloadAlignment) % PayloadAlignment, '\0');
+			}
+			if ((flags & DeltaFlag) != 0)
+			{
+				tables.append(reinterpret_cast<const char*>(&mRecordCount), sizeof(mRecordCount));
+			}
+
+			out.write(tables.c_str(), tables.size());
+			out.write(mBody.c_str(), mBody.size());
+			if (!out)
+			{
+				throw std::runtime_error("Unable to write the binary world.");
+			}
+			mBody.clear();
+		}
+
+		void BinaryWorldWriter::WriteToFile(const Scope& root, const std::string& filename)
+		{
+			std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+			if (!out.is_open())
+			{
+				throw std::runtime_error(std::string("Unable to create binary world file. filename = ").append(filename));
+			}
+			Write(root, out);
+		}
+
+		void BinaryWorldWriter::AlignBody()
+		{
+			if (mIsAligningBody)
+			{
+				mBody.append((PayloadAlignment - mBody.size() % PayloadAlignment) % PayloadAlignment, '\0');
+			}
+		}
+
+		void BinaryWorldWriter::WriteBytes(const void* data, std::uint64_t size)
+		{
+			mBody.append(static_cast<const char*>(data), static_cast<std::size_t>(size));
+		}
+
+		template <typename T>
+		void BinaryWorldWriter::WriteValue(const T& value)
+		{
+			WriteBytes(&value, sizeof(T));
+		}
+
+		void BinaryWorldWriter::WriteScope(const Scope& scope)
+		{
+			WriteValue(TypeIndex(scope.TypeNameInstance()));
+			WriteValue(scope.Size());
+
+			for (std::uint32_t index = 0; index < scope.Size(); ++index)
+			{
+				WriteDatum(scope.GetKey(index), scope[index]);
+			}
+		}
+
+		void BinaryWorldWriter::WriteDatum(const std::string& key, const Datum& datum)
+		{
+			std::uint32_t size = datum.Size();
+			WriteValue(StringIndex(key));
+			WriteValue(static_cast<std::uint8_t>(datum.Type()));
+			WriteValue(size);
+			if (size == 0)
+			{
+				return;
+			}
+
+			switch (datum.Type())
+			{
+			case Datum::DatumType::Integer:
+				AlignBody();
+				WriteBytes(&datum.Get<std::int32_t>(), sizeof(std::int32_t) * size);
+				break;
+			case Datum::DatumType::Float:
+				AlignBody();
+				WriteBytes(&datum.Get<float>(), sizeof(float) * size);
+				break;
+			case Datum::DatumType::Vector:
+				AlignBody();
+				WriteBytes(&datum.Get<glm::vec4>(), sizeof(glm::vec4) * size);
+				break;
+			case Datum::DatumType::Matrix:
+				AlignBody();
+				WriteBytes(&datum.Get<glm::mat4>(), sizeof(glm::mat4) * size);
+				break;
+			case Datum::DatumType::String:
+				for (std::uint32_t valueIndex = 0; valueIndex < size; ++valueIndex)
+				{
+					WriteValue(StringIndex(datum.Get<std::string>(valueIndex)));
+				}
+				break;
+			case Datum::DatumType::Scope:
+				for (std::uint32_t valueIndex = 0; valueIndex < size; ++valueIndex)
+				{
+					WriteScope(datum.Get<Scope>(valueIndex));
+				}
+				break;
+			default:
+				// pointers are meaningless in another process, only the size is kept
+				break;
+			}
+		}
+
+		void BinaryWorldWriter::WriteChanges(Scope& scope)
+		{
+			for (std::uint32_t index = 0; index < scope.Size(); ++index)
+			{
+				Datum& datum = scope[index];
+				const std::string& key = scope.GetKey(index);
+				DatumKey datumKey(scope.Generation(), index);
+				if (datum.Type() == Datum::DatumType::Scope)
+				{
+					WriteScopeChanges(datumKey, key, datum);
+				}
+				else if (HasChanged(datumKey, datum))
+				{
+					WriteRecordHeader(ReplaceRecord);
+					WriteDatum(key, datum);
+					datum.ClearDirty();
+				}
+			}
+		}
+
+		void BinaryWorldWriter::WriteScopeChanges(const DatumKey& datumKey, const std::string& key, Datum& datum)
+		{
+			// children appended since the checkpoint are written whole and the ones before them are searched for changes
+			std::uint32_t size = datum.Size();
+			std::uint32_t keptCount = datum.IsDirty() ? KeptChildCount(datumKey, datum) : size;
+			if (keptCount > size)
+			{
+				WriteRecordHeader(ReplaceRecord);
+				WriteDatum(key, datum);
+				for (std::uint32_t valueIndex = 0; valueIndex < size; ++valueIndex)
+				{
+					ClearChanges(datum.Get<Scope>(valueIndex));
+				}
+			}
+			else
+			{
+				for (std::uint32_t valueIndex = 0; valueIndex < keptCount; ++valueIndex)
+				{
+					mPath.PushBack(std::make_pair(&key, valueIndex));
+					WriteChanges(datum.Get<Scope>(valueIndex));
+					mPath.PopBack();
+				}
+				if (keptCount < size)
+				{
+					WriteRecordHeader(AppendRecord);
+					WriteValue(StringIndex(key));
+					WriteValue(static_cast<std::uint8_t>(Datum::DatumType::Scope));
+					WriteValue(size - keptCount);
+					for (std::uint32_t valueIndex = keptCount; valueIndex < size; ++valueIndex)
+					{
+						WriteScope(datum.Get<Scope>(valueIndex));
+						ClearChanges(datum.Get<Scope>(valueIndex));
+					}
+				}
+			}
+			datum.ClearDirty();
+			RecordState(datumKey, datum);
+		}
+
+		void BinaryWorldWriter::WriteRecordHeader(std::uint8_t kind)
+		{
+			WriteValue(mPath.Size());
+			for (const auto& step : mPath)
+			{
+				WriteValue(StringIndex(*step.first));
+				WriteValue(step.second);
+			}
+			WriteValue(kind);
+			++mRecordCount;
+		}
+
+		void BinaryWorldWriter::ClearChanges(Scope& scope)
+		{
+			for (std::uint32_t index = 0; index < scope.Size(); ++index)
+			{
+				Datum& datum = scope[index];
+				datum.ClearDirty();
+				if (datum.Type() == Datum::DatumType::Scope)
+				{
+					for (std::uint32_t valueIndex = 0; valueIndex < datum.Size(); ++valueIndex)
+					{
+						ClearChanges(datum.Get<Scope>(valueIndex));
+					}
+					RecordState(DatumKey(scope.Generation(), index), datum);
+				}
+				else if (datum.IsExternal() && datum.Type() != Datum::DatumType::RTTI)
+				{
+					RecordState(DatumKey(scope.Generation(), index), datum);
+				}
+			}
+		}
+
+		bool BinaryWorldWriter::HasChanged(const DatumKey& datumKey, const Datum& datum)
+		{
+			bool hasChanged = datum.IsDirty();
+
+			// members behind external storage can be written without going through the datum
+			if (datum.IsExternal() && datum.Type() != Datum::DatumType::RTTI)
+			{
+				auto it = mStates.Find(datumKey);
+				hasChanged |= (it == mStates.end() || it->second != RecordState(datumKey, datum));
+			}
+			return hasChanged;
+		}
+
+		std::uint32_t BinaryWorldWriter::KeptChildCount(const DatumKey& datumKey, const Datum& datum) const
+		{
+			// a datum which isn't known, or no longer starts with the children it had, has to be replaced
+			auto it = mStates.Find(datumKey);
+			if (it == mStates.end() || it->second.first > datum.Size() || it->second.second != Hash(datum, it->second.first))
+			{
+				return std::numeric_limits<std::uint32_t>::max();
+			}
+			return it->second.first;
+		}
+
+		const BinaryWorldWriter::DatumState& BinaryWorldWriter::RecordState(const DatumKey& datumKey, const Datum& datum)
+		{
+			bool hasInserted;
+			return mNextStates.Insert(std::make_pair(datumKey, std::make_pair(datum.Size(), Hash(datum, datum.Size()))), hasInserted)->second;
+		}
+
+		std::uint32_t BinaryWorldWriter::DatumKeyHash::operator()(const DatumKey& datumKey) const
+		{
+			return HashFunctions::MixInteger(datumKey.first) + datumKey.second;
+		}
+
+		std::uint64_t BinaryWorldWriter::Hash(const Datum& datum, std::uint32_t size)
+		{
+			// 64 bit FNV-1a, which is plenty to notice a change in one datum
+			std::uint64_t hash = 14695981039346656037ULL;
+			auto hashBytes = [&hash](const void* data, std::size_t size)
+			{
+				const unsigned char* bytes = static_cast<const unsigned char*>(data);
+				for (std::size_t index = 0; index < size; ++index)
+				{
+					hash = (hash ^ bytes[index]) * 1099511628211ULL;
+				}
+			};
+
+			hashBytes(&size, sizeof(size));
+			if (size == 0)
+			{
+				return hash;
+			}
+			switch (datum.Type())
+			{
+			case Datum::DatumType::Integer:
+				hashBytes(&datum.Get<std::int32_t>(), sizeof(std::int32_t) * size);
+				break;
+			case Datum::DatumType::Float:
+				hashBytes(&datum.Get<float>(), sizeof(float) * size);
+				break;
+			case Datum::DatumType::Vector:
+				hashBytes(&datum.Get<glm::vec4>(), sizeof(glm::vec4) * size);
+				break;
+			case Datum::DatumType::Matrix:
+				hashBytes(&datum.Get<glm::mat4>(), sizeof(glm::mat4) * size);
+				break;
+			case Datum::DatumType::String:
+				for (std::uint32_t index = 0; index < size; ++index)
+				{
+					const std::string& value = datum.Get<std::string>(index);
+					hashBytes(value.c_str(), value.size() + 1);
+				}
+				break;
+			case Datum::DatumType::Scope:
+				// lists of scopes are told apart by which scopes they hold. Addresses are reused once a scope is destroyed,
+				// generations aren't
+				for (std::uint32_t index = 0; index < size; ++index)
+				{
+					std::uint64_t generation = datum.Get<Scope>(index).Generation();
+					hashBytes(&generation, sizeof(generation));
+				}
+				break;
+			default:
+				break;
+			}
+			return hash;
+		}
+
+		std::uint32_t BinaryWorldWriter::StringIndex(const std::string& value)
+		{
+			bool hasInserted;
+			auto it = mStringIndices.Insert(std::make_pair(value, mStrings.Size()), hasInserted);
+			if (hasInserted)
+			{
+				mStrings.PushBack(value);
+			}
+			return it->second;
+		}
+
+		std::uint32_t BinaryWorldWriter::TypeIndex(const std::string& typeName)
+		{
+			bool hasInserted;
+			auto it = mTypeIndices.Insert(std::make_pair(typeName, mTypes.Size()), hasInserted);
+			if (hasInserted)
+			{
+				mTypes.PushBack(StringIndex(typeName));
+			}
+			return it->second;
+		}
+	}
+}
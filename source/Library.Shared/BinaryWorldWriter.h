@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include "HashMap.h"
+#include "Scope.h"
+#include "Vector.h"
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		/** Writes a scope hierarchy, usually a whole world, in the binary world format read by BinaryWorldReader.
+		 *
+		 *  The format starts with a header, followed by a string table holding every distinct key and string value once,
+		 *  a type table holding the type name of every distinct scope class once, and then the scopes themselves in
+		 *  depth first order. A scope is its type index and datum count followed by its datums in order of insertion.
+		 *  A datum is its key index, its type and its size followed by its values: integers, floats, vectors and
+		 *  matrices as one flat block in native layout, strings as string table indices and scopes as nested scope
+		 *  records. Pointers can't outlive the process, so RTTI datums only keep their key.
+		 *
+		 *  A writer can also align the tables and every numeric block to PayloadAlignment bytes, which lets
+		 *  WorldSnapshot use the blocks of a mapped file in place as datum storage.
+		 *
+		 *  After a Checkpoint, WriteDelta writes only the datums which changed since, as records made of the path to
+		 *  their scope followed by the datum in the format above. A datum has changed if it was written through since
+		 *  the checkpoint, see Datum::IsDirty, or, for prescribed attributes which are written through their members,
+		 *  if the hash of its values differs. Scopes appended to a list are written whole in a record of their own, so a
+		 *  new entity doesn't rewrite its siblings, while a list which lost or reordered scopes is replaced. Each delta becomes the next checkpoint, so a chain of deltas applied in
+		 *  order with BinaryWorldReader::ApplyDelta brings a copy of the base world up to date
+		 */
+		class BinaryWorldWriter final
+		{
+		public:
+			/** The first bytes of every binary world
+			 */
+			static const char Magic[4];
+			/** The version of the format written by this class
+			 */
+			static const std::uint32_t Version;
+			/** Header flag set when numeric blocks are aligned
+			 */
+			static const std::uint32_t AlignedPayloadsFlag;
+			/** The alignment of numeric blocks in an aligned binary world
+			 */
+			static const std::uint32_t PayloadAlignment;
+			/** Header flag set when the binary world is a delta rather than a whole world
+			 */
+			static const std::uint32_t DeltaFlag;
+			/** Kind of a delta record whose datum replaces the datum at the same key
+			 */
+			static const std::uint8_t ReplaceRecord;
+			/** Kind of a delta record whose scopes are appended to the datum at the same key
+			 */
+			static const std::uint8_t AppendRecord;
+
+			/** Initialize a writer
+			 *  @param alignPayloads Whether numeric blocks are aligned so they can be used in place
+			 */
+			explicit BinaryWorldWriter(bool alignPayloads = false);
+			/** Free up allocated resources
+			 */
+			~BinaryWorldWriter() = default;
+
+			// Delete move and copy semantics
+			BinaryWorldWriter(const BinaryWorldWriter&) = delete;
+			BinaryWorldWriter& operator=(const BinaryWorldWriter&) = delete;
+
+			/** Write a scope and everything under it to a stream
+			 *  @param root The scope to write
+			 *  @param out The stream to write to. Should be opened in binary mode
+			 *  @exception std::runtime_error Thrown if writing to the stream fails
+			 */
+			void Write(const Scope& root, std::ostream& out);
+			/** Write a scope and everything under it to a file
+			 *  @param root The scope to write
+			 *  @param filename The name of the file to create or overwrite
+			 *  @exception std::runtime_error Thrown if the file can't be written
+			 */
+			void WriteToFile(const Scope& root, const std::string& filename);
+			/** Mark the current state of a scope hierarchy as the base later deltas are relative to
+			 *  @param root The scope whose state is recorded. Usually the one which was just written
+			 */
+			void Checkpoint(Scope& root);
+			/** Write the datums which changed since the last checkpoint or delta to a stream, then checkpoint
+			 *  @param root The scope which was checkpointed
+			 *  @param out The stream to write to. Should be opened in binary mode
+			 *  @exception std::runtime_error Thrown if writing to the stream fails
+			 */
+			void WriteDelta(Scope& root, std::ostream& out);
+			/** Write the datums which changed since the last checkpoint or delta to a file, then checkpoint
+			 *  @param root The scope which was checkpointed
+			 *  @param filename The name of the file to create or overwrite
+			 *  @exception std::runtime_error Thrown if the file can't be written
+			 */
+			void WriteDeltaToFile(Scope& root, const std::string& filename);
+		private:
+			// Empty the tables and the body before writing
+			void Reset(bool alignBody);
+			// Write the header and the tables followed by the body
+			void Output(std::ostream& out, std::uint32_t flags);
+			// Append a scope record and all its children to the body
+			void WriteScope(const Scope& scope);
+			// Append a datum record to the body
+			void WriteDatum(const std::string& key, const Datum& datum);
+			// Append delta records for the changed datums under a scope
+			void WriteChanges(Scope& scope);
+			// The generation of the scope holding a datum and the index of the datum in it, which identify the datum
+			// between checkpoints even if its scope is destroyed and another one takes its place
+			typedef std::pair<std::uint64_t, std::uint32_t> DatumKey;
+			// Hashes datum keys for the state maps
+			class DatumKeyHash
+			{
+			public:
+				std::uint32_t operator()(const DatumKey& datumKey) const;
+			};
+			// Append delta records for a datum holding scopes and for the changes under the scopes it kept
+			void WriteScopeChanges(const DatumKey& datumKey, const std::string& key, Datum& datum);
+			// Append the path to the current scope and the kind of a delta record
+			void WriteRecordHeader(std::uint8_t kind);
+			// Clear the changes of every datum under a scope and record the state of the datums checked by state
+			void ClearChanges(Scope& scope);
+			// Whether a datum changed since the last checkpoint, recording the state of a prescribed attribute
+			bool HasChanged(const DatumKey& datumKey, const Datum& datum);
+			// How many scopes a datum kept from the start of its list since the last checkpoint, or more than its size
+			// if it has to be replaced
+			std::uint32_t KeptChildCount(const DatumKey& datumKey, const Datum& datum) const;
+			// The size and hash of a datum at a checkpoint
+			typedef std::pair<std::uint32_t, std::uint64_t> DatumState;
+			// Record the size and hash of a datum for the next checkpoint
+			const DatumState& RecordState(const DatumKey& datumKey, const Datum& datum);
+			// Hash the first values of a datum, or the generations of the first scopes of a datum holding scopes
+			static std::uint64_t Hash(const Datum& datum, std::uint32_t size);
+			// Pad the body so the next numeric block is aligned, if blocks are aligned
+			void AlignBody();
+			// Append raw bytes to the body
+			void WriteBytes(const void* data, std::uint64_t size);
+			// Append a plain value to the body
+			template <typename T>
+			void WriteValue(const T& value);
+			// Get the index of a string in the string table, adding it if needed
+			std::uint32_t StringIndex(const std::string& value);
+			// Get the index of a type in the type table, adding it if needed
+			std::uint32_t TypeIndex(const std::string& typeName);
+
+			// Whether numeric blocks are aligned
+			bool mAlignPayloads;
+			// Whether numeric blocks of what is being written are aligned
+			bool mIsAligningBody;
+			// Distinct strings in order of first use and their indices
+			Vector<std::string> mStrings;
+			HashMap<std::string, std::uint32_t> mStringIndices;
+			// String table indices of the distinct scope type names in order of first use, and their type indices
+			Vector<std::uint32_t> mTypes;
+			HashMap<std::string, std::uint32_t> mTypeIndices;
+			// The scope records, written after the tables once they are complete
+			std::string mBody;
+			// The keys and indices leading to the scope whose changes are being written
+			Vector<std::pair<const std::string*, std::uint32_t>> mPath;
+			// The number of records in the delta being written
+			std::uint32_t mRecordCount;
+			// States of the prescribed attributes and the datums holding scopes at the last checkpoint, and the ones
+			// being recorded for the next
+			HashMap<DatumKey, DatumState, DatumKeyHash> mStates;
+			HashMap<DatumKey, DatumState, DatumKeyHash> mNextStates;
+		};
+	}
+}
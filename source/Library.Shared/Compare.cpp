@@ -7,4 +7,14 @@ namespace AnonymousEngine
 	{
 		return (strcmp(lhs, rhs) == 0);
 	}
+
+	bool DefaultCompare<const std::string>::operator()(const std::string& lhs, const std::string& rhs) const
+	{
+		return (lhs == rhs);
+	}
+
+	bool DefaultCompare<const std::string>::operator()(const std::string& lhs, const char* rhs) const
+	{
+		return (lhs.compare(rhs) == 0);
+	}
 }
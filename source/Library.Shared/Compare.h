@@ -1,7 +1,11 @@
 #pragma once
 
+#include <string>
+
 namespace AnonymousEngine
 {
+	class HashedName;
+
 	/** This class is used by containers like hashmap to compare two items
 	 *  This default implementation simply uses the equality operator on the objects
 	 *  Specializations can be added for other types as required
@@ -31,6 +35,33 @@ namespace AnonymousEngine
 		*/
 		bool operator()(const char* lhs, const char* rhs) const;
 	};
+
+	/** Specialization for std::string comparison. A string can also be compared with a C string, which lets a hashmap
+	 *  with string keys be searched with a C string without constructing a temporary string
+	*/
+	template <>
+	class DefaultCompare<const std::string>
+	{
+	public:
+		/** Checks if lhs is logically equivalent to rhs
+		*  @param lhs The left hand side of the equality
+		*  @param rhs The right hand side of the equality
+		*  @return Boolean indicating whether left hand side is logically equivalent to right hand side
+		*/
+		bool operator()(const std::string& lhs, const std::string& rhs) const;
+		/** Checks if lhs is logically equivalent to rhs
+		*  @param lhs The left hand side of the equality
+		*  @param rhs The right hand side of the equality, which can't be nullptr
+		*  @return Boolean indicating whether left hand side is logically equivalent to right hand side
+		*/
+		bool operator()(const std::string& lhs, const char* rhs) const;
+		/** Checks if lhs is logically equivalent to the name rhs carries
+		*  @param lhs The left hand side of the equality
+		*  @param rhs The right hand side of the equality
+		*  @return Boolean indicating whether left hand side is logically equivalent to right hand side
+		*/
+		bool operator()(const std::string& lhs, const HashedName& rhs) const;
+	};
 }
 
 #include "Compare.inl"
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+#include <shared_mutex>
+#include "HashMap.h"
+
+namespace AnonymousEngine
+{
+	/** A hashmap which can be used from many threads at once, meant for registries which are read far more often than
+	 *  they are written. The entries are spread over ShardCount hashmaps by the high bits of the hash of their key and
+	 *  every shard has its own reader writer lock, so lookups from different threads only share a lock when they hit
+	 *  the same shard, and even then they don't block one another. Only inserts and removes take a shard exclusively
+	 */
+	template <typename TKey, typename TData, typename THashFunctor = DefaultHashFunctor<const TKey>, typename TCompareFunctor = DefaultCompare<const TKey>>
+	class ConcurrentHashMap final
+	{
+		typedef HashMap<TKey, TData, THashFunctor, TCompareFunctor> ShardMap;
+	public:
+		/** The type of each entry in the hashmap
+		 */
+		typedef typename ShardMap::EntryType EntryType;
+
+		/** Iterator to the hashmap. Iterating takes no locks, so it should only be done while no other thread inserts or
+		 *  removes entries, such as once all the registrations are done
+		 */
+		class Iterator
+		{
+		public:
+			/** Default constructor
+			 */
+			Iterator();
+			/** Copy constructor with default implementation
+			 *  @param rhs The iterator to copy from
+			 */
+			Iterator(const Iterator& rhs) = default;
+			/** Copy assignment operator with default implementation
+			 *  @param rhs The iterator to assign from
+			 *  @return A reference to the current iterator
+			 */
+			Iterator& operator=(const Iterator& rhs) = default;
+			/** Destructor with default implementation
+			 */
+			~Iterator() = default;
+
+			/** Moves the iterator to next location
+			 *  @return A reference to the current iterator
+			 *  @exception std::invalid_argument Thrown if the iterator is uninitialized
+			 *  @exception std::out_of_range Thrown if the iterator is at the end
+			 */
+			Iterator& operator++();
+			/** Moves the iterator to next location
+			 *  @return An iterator which points to the location before the increment
+			 */
+			Iterator operator++(int);
+
+			/** Get the entry in the hashmap at the location pointed by the iterator
+			 *  @return A reference to the entry at the location pointed by the iterator
+			 */
+			EntryType& operator*();
+			/** Get the entry in the hashmap at the location pointed by the iterator. Constant version
+			 *  @return A reference to the entry at the location pointed by the iterator
+			 */
+			const EntryType& operator*() const;
+			/** Get the entry in the hashmap at the location pointed by the iterator
+			 *  @return A pointer to the entry at the location pointed by the iterator
+			 */
+			EntryType* operator->();
+			/** Get the entry in the hashmap at the location pointed by the iterator. Constant version
+			 *  @return A pointer to the entry at the location pointed by the iterator
+			 */
+			const EntryType* operator->() const;
+
+			/** Check if two iterators are equal
+			 *  @param rhs The other iterator to which the current one should be compared
+			 *  @return True if both the iterators are same. False otherwise
+			 */
+			bool operator==(const Iterator& rhs) const;
+			/** Check if two iterators are not equal
+			 *  @param rhs The other iterator to which the current one should be compared
+			 *  @return False if both the iterators are same. True otherwise
+			 */
+			bool operator!=(const Iterator& rhs) const;
+		private:
+			// The shard the iterator is in
+			std::uint32_t mShard;
+			// The position in the hashmap of the shard
+			typename ShardMap::Iterator mIterator;
+			const ConcurrentHashMap* mOwner;
+
+			// initialize the iterator with given values, moving on to the next entry if the position is at the end of a shard
+			Iterator(std::uint32_t shard, const typename ShardMap::Iterator& it, const ConcurrentHashMap* owner);
+			// Move on to the first entry of the next shards while the position is at the end of a shard
+			void SkipEmptyShards();
+
+			friend ConcurrentHashMap;
+		};
+
+		/** Initializes an empty hashmap
+		 *  @param bucketsPerShard The number of buckets of the hashmap of each shard
+		 *  @exception std::invalid_argument Thrown if the number of buckets is zero
+		 */
+		explicit ConcurrentHashMap(std::uint32_t bucketsPerShard = 13U);
+		/** Finalizes the hashmap
+		 */
+		~ConcurrentHashMap() = default;
+
+		// Delete move and copy semantics
+		ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+		/** Searches for a key and copies out its data. The key can be any type THashFunctor and TCompareFunctor accept
+		 *  @param key The key to search for
+		 *  @param data Out parameter set to a copy of the data of the key if it is found
+		 *  @return True if the key was found
+		 */
+		template <typename TLookupKey>
+		bool Find(const TLookupKey& key, TData& data) const;
+		/** Searches for a key without copying its data and without ever inserting it. The data stays valid until the key
+		 *  is removed, but the hashmap doesn't guard it
+		 *  @param key The key to search for
+		 *  @return The address of the data of the key, or nullptr if the key is not found
+		 */
+		template <typename TLookupKey>
+		const TData* Find(const TLookupKey& key) const;
+		/** Checks if a given key is present in the hashmap
+		 *  @param key The key to search for
+		 *  @return A boolean indicating whether the key is present in the hashmap or not
+		 */
+		template <typename TLookupKey>
+		bool ContainsKey(const TLookupKey& key) const;
+
+		/** Insert an entry into the hashmap. This method would not overwrite any existing element with the same key
+		 *  @param entry The entry to insert into the hashmap
+		 *  @return True if the entry was inserted, false if the key was already present
+		 */
+		bool Insert(const EntryType& entry);
+		/** Run a function on the data of a key while holding its shard exclusively, so the data can be checked and
+		 *  changed without another thread getting in between. A key which isn't present is inserted first with default
+		 *  initialized data, which stays inserted even if the function throws
+		 *  @param key The key whose data is to be updated
+		 *  @param function A callable taking a TData&
+		 */
+		template <typename TFunction>
+		void Update(const TKey& key, TFunction function);
+		/** Returns a reference to the data element for a given key.
+		 *  If the given key does not exist in the hashmap, insert a default initialized value and return a reference to
+		 *  that. The reference stays valid until the key is removed, but the hashmap doesn't guard the data behind it
+		 *  @param key The key for which the element has to be retrieved
+		 *  @returns A reference to the data for the given key
+		 */
+		TData& operator[](const TKey& key);
+		/** Remove the entry of a key from the hashmap
+		 *  @param key The key of the element which should be removed from the hashmap
+		 *  @return A boolean indicating whether the element was removed or not
+		 */
+		bool Remove(const TKey& key);
+
+		/** Clears the contents of the hashmap
+		 */
+		void Clear();
+		/** Get the number of elements in the hashmap. Other threads can change it as soon as it is read
+		 *  @return The number of elements in the hashmap
+		 */
+		std::uint32_t Size() const;
+
+		/** Run a function on every entry of the hashmap, holding each shard shared while its entries are visited. The
+		 *  function can't insert into or remove from the hashmap
+		 *  @param function A callable taking a const EntryType&
+		 */
+		template <typename TFunction>
+		void ForEach(TFunction function) const;
+
+		/** Return an iterator to the beginning of the hashmap
+		 *  @return An iterator to the beginning of the hashmap
+		 */
+		Iterator begin() const;
+		/** Return an iterator to the end of the hashmap
+		 *  @return An iterator to the end of the hashmap
+		 */
+		Iterator end() const;
+
+		/** The number of shards the entries are spread over
+		 */
+		static const std::uint32_t ShardCount = 16U;
+	private:
+		// A part of the entries with the lock guarding them
+		struct Shard
+		{
+			mutable std::shared_timed_mutex mMutex;
+			ShardMap mMap;
+		};
+
+		Shard mShards[ShardCount];
+
+		// Calculate the full hash of a key
+		template <typename TLookupKey>
+		static std::uint32_t Hash(const TLookupKey& key);
+		// Get the shard of a hash. The buckets of a shard are picked by the hash modulo their count, so the shard is
+		// picked by its high bits to keep the two independent
+		static std::uint32_t ShardIndex(std::uint32_t hash);
+	};
+}
+
+#include "ConcurrentHashMap.inl"
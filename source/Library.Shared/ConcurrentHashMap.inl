@@ -0,0 +1,250 @@
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace AnonymousEngine
+{
+#pragma region ConcurrentHashMapIteratorMethods
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::Iterator() :
+		mShard(0), mOwner(nullptr)
+	{
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::Iterator(std::uint32_t shard, const typename ShardMap::Iterator& it, const ConcurrentHashMap* owner) :
+		mShard(shard), mIterator(it), mOwner(owner)
+	{
+		SkipEmptyShards();
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator& ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::invalid_argument("Uninitialized iterator");
+		}
+
+		++mIterator;
+		SkipEmptyShards();
+		return (*this);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator++(int)
+	{
+		Iterator it = (*this);
+		operator++();
+		return it;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::EntryType& ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator*()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::invalid_argument("Uninitialized iterator");
+		}
+		return *mIterator;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	const typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::EntryType& ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator*() const
+	{
+		return const_cast<const EntryType&>(const_cast<typename ConcurrentHashMap::Iterator*>(this)->operator*());
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::EntryType* ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator->()
+	{
+		return &operator*();
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	const typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::EntryType* ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator==(const Iterator& rhs) const
+	{
+		return (mOwner == rhs.mOwner && mShard == rhs.mShard && mIterator == rhs.mIterator);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator!=(const Iterator& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	void ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::SkipEmptyShards()
+	{
+		while (mShard + 1 < ShardCount && mIterator == mOwner->mShards[mShard].mMap.end())
+		{
+			++mShard;
+			mIterator = mOwner->mShards[mShard].mMap.begin();
+		}
+	}
+
+#pragma endregion
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	const std::uint32_t ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::ShardCount;
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::ConcurrentHashMap(std::uint32_t bucketsPerShard)
+	{
+		for (auto& shard : mShards)
+		{
+			shard.mMap = ShardMap(bucketsPerShard);
+		}
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TLookupKey>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Find(const TLookupKey& key, TData& data) const
+	{
+		std::uint32_t hash = Hash(key);
+		const Shard& shard = mShards[ShardIndex(hash)];
+		std::shared_lock<std::shared_timed_mutex> lock(shard.mMutex);
+		auto it = shard.mMap.Find(key, hash);
+		if (it == shard.mMap.end())
+		{
+			return false;
+		}
+		data = it->second;
+		return true;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TLookupKey>
+	const TData* ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Find(const TLookupKey& key) const
+	{
+		std::uint32_t hash = Hash(key);
+		const Shard& shard = mShards[ShardIndex(hash)];
+		std::shared_lock<std::shared_timed_mutex> lock(shard.mMutex);
+		auto it = shard.mMap.Find(key, hash);
+		return (it != shard.mMap.end()) ? &it->second : nullptr;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TLookupKey>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::ContainsKey(const TLookupKey& key) const
+	{
+		std::uint32_t hash = Hash(key);
+		const Shard& shard = mShards[ShardIndex(hash)];
+		std::shared_lock<std::shared_timed_mutex> lock(shard.mMutex);
+		return shard.mMap.ContainsKey(key, hash);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Insert(const EntryType& entry)
+	{
+		Shard& shard = mShards[ShardIndex(Hash(entry.first))];
+		std::lock_guard<std::shared_timed_mutex> lock(shard.mMutex);
+		bool hasInserted;
+		shard.mMap.Insert(entry, hasInserted);
+		return hasInserted;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TFunction>
+	void ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Update(const TKey& key, TFunction function)
+	{
+		Shard& shard = mShards[ShardIndex(Hash(key))];
+		std::lock_guard<std::shared_timed_mutex> lock(shard.mMutex);
+		function(shard.mMap[key]);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	TData& ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::operator[](const TKey& key)
+	{
+		std::uint32_t hash = Hash(key);
+		Shard& shard = mShards[ShardIndex(hash)];
+		{
+			std::shared_lock<std::shared_timed_mutex> lock(shard.mMutex);
+			auto it = shard.mMap.Find(key, hash);
+			if (it != shard.mMap.end())
+			{
+				return it->second;
+			}
+		}
+		// another thread may have inserted the key in between, which the indexer of the shard takes care of
+		std::lock_guard<std::shared_timed_mutex> lock(shard.mMutex);
+		return shard.mMap[key];
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Remove(const TKey& key)
+	{
+		Shard& shard = mShards[ShardIndex(Hash(key))];
+		std::lock_guard<std::shared_timed_mutex> lock(shard.mMutex);
+		return shard.mMap.Remove(key);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	void ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Clear()
+	{
+		for (auto& shard : mShards)
+		{
+			std::lock_guard<std::shared_timed_mutex> lock(shard.mMutex);
+			shard.mMap.Clear();
+		}
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	std::uint32_t ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Size() const
+	{
+		std::uint32_t size = 0;
+		for (const auto& shard : mShards)
+		{
+			std::shared_lock<std::shared_timed_mutex> lock(shard.mMutex);
+			size += shard.mMap.Size();
+		}
+		return size;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TFunction>
+	void ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::ForEach(TFunction function) const
+	{
+		for (const auto& shard : mShards)
+		{
+			std::shared_lock<std::shared_timed_mutex> lock(shard.mMutex);
+			for (const auto& entry : shard.mMap)
+			{
+				function(entry);
+			}
+		}
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::begin() const
+	{
+		return Iterator(0, mShards[0].mMap.begin(), this);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	typename ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::end() const
+	{
+		return Iterator(ShardCount - 1, mShards[ShardCount - 1].mMap.end(), this);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TLookupKey>
+	std::uint32_t ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::Hash(const TLookupKey& key)
+	{
+		static THashFunctor hashFunctor;
+		return hashFunctor(key);
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	std::uint32_t ConcurrentHashMap<TKey, TData, THashFunctor, TCompareFunctor>::ShardIndex(std::uint32_t hash)
+	{
+		return static_cast<std::uint32_t>((static_cast<std::uint64_t>(hash) * ShardCount) >> 32);
+	}
+}
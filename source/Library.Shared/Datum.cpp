@@ -1,5 +1,6 @@
 #include <glm/gtc/type_ptr.hpp>
 #include "Datum.h"
+#include "NumberParser.h"
 #include "Scope.h"
 
 namespace AnonymousEngine
@@ -69,34 +70,20 @@ namespace AnonymousEngine
 	const std::function<void(const std::string&, Datum::DatumValue&, std::uint32_t)> Datum::Deserializers[] = {
 
 		[] (const std::string&, DatumValue&, std::uint32_t) { throw std::runtime_error("Unsupported operation"); },			// Unknown
-		[] (const std::string& str, DatumValue& datum, std::uint32_t index) { datum.intValue[index] = std::stoi(str); },	// Integer
-		[] (const std::string& str, DatumValue& datum, std::uint32_t index) { datum.floatValue[index] = std::stof(str); },	// Float
+		[] (const std::string& str, DatumValue& datum, std::uint32_t index) { datum.intValue[index] = NumberParser::ToInt(str); },	// Integer
+		[] (const std::string& str, DatumValue& datum, std::uint32_t index) { datum.floatValue[index] = NumberParser::ToFloat(str); },	// Float
 		[] (const std::string& str, DatumValue& datum, std::uint32_t index) { datum.strValue[index] = str; },				// String
 		[] (const std::string& str, DatumValue& datum, std::uint32_t index)		// Vec4
 			{
-				glm::vec4& vector = datum.vecValue[index];
-				std::size_t tempPos;
-				std::size_t pos = 0;
-				vector.x = std::stof(str, &tempPos);
-				pos += (tempPos + 1);
-				vector.y = std::stof(str.substr(pos), &tempPos);
-				pos += (tempPos + 1);
-				vector.z = std::stof(str.substr(pos), &tempPos);
-				pos += (tempPos + 1);
-				vector.w = std::stof(str.substr(pos), &tempPos);
+				float values[4];
+				NumberParser::Parse(str, values, 4);
+				datum.vecValue[index] = glm::make_vec4(values);
 			},
 		[] (const std::string& str, DatumValue& datum, std::uint32_t index)		// Mat4
 			{
-				glm::mat4& mat = datum.matValue[index];
 				float values[16];
-				std::size_t tempPos;
-				std::size_t pos = 0;
-				for(std::uint32_t i = 0; i < 16; ++i)
-				{
-					values[i] = std::stof(str.substr(pos), &tempPos);
-					pos += (tempPos + 1);
-				}
-				mat = glm::make_mat4(values);
+				NumberParser::Parse(str, values, 16);
+				datum.matValue[index] = glm::make_mat4(values);
 			},
 		[] (const std::string& str, DatumValue& datum, std::uint32_t index) { datum.scopeValue[index]->FromString(str); },  // Scope*
 		[] (const std::string& str, DatumValue& datum, std::uint32_t index)  	// RTTI*
@@ -142,7 +129,7 @@ namespace AnonymousEngine
 	};
 
 	Datum::Datum(DatumType type) :
-		mType(type), mSize(0), mIsExternal(false)
+		mType(type), mSize(0), mIsExternal(false), mIsDirty(true)
 	{
 		mData.voidPtr = nullptr;
 	}
@@ -162,6 +149,7 @@ namespace AnonymousEngine
 	void Datum::SetType(DatumType type)
 	{
 		ValidateType(type);
+		mIsDirty |= (mType != type);
 		mType = type;
 	}
 
@@ -243,6 +231,7 @@ namespace AnonymousEngine
 	{
 		ValidateType(DatumType::Integer);
 		ValidateIndex(index);
+		mIsDirty = true;
 		mData.intValue[index] = data;
 	}
 
@@ -250,6 +239,7 @@ namespace AnonymousEngine
 	{
 		ValidateType(DatumType::Float);
 		ValidateIndex(index);
+		mIsDirty = true;
 		mData.floatValue[index] = data;
 	}
 
@@ -257,6 +247,7 @@ namespace AnonymousEngine
 	{
 		ValidateType(DatumType::String);
 		ValidateIndex(index);
+		mIsDirty = true;
 		mData.strValue[index] = data;
 	}
 
@@ -264,6 +255,7 @@ namespace AnonymousEngine
 	{
 		ValidateType(DatumType::Vector);
 		ValidateIndex(index);
+		mIsDirty = true;
 		mData.vecValue[index] = data;
 	}
 
@@ -271,6 +263,7 @@ namespace AnonymousEngine
 	{
 		ValidateType(DatumType::Matrix);
 		ValidateIndex(index);
+		mIsDirty = true;
 		mData.matValue[index] = data;
 	}
 
@@ -278,6 +271,7 @@ namespace AnonymousEngine
 	{
 		ValidateType(DatumType::Scope);
 		ValidateIndex(index);
+		mIsDirty = true;
 		mData.scopeValue[index] = &data;
 	}
 
@@ -285,6 +279,7 @@ namespace AnonymousEngine
 	{
 		ValidateType(DatumType::RTTI);
 		ValidateIndex(index);
+		mIsDirty = true;
 		mData.rttiPtrValue[index] = data;
 	}
 
@@ -351,6 +346,7 @@ namespace AnonymousEngine
 		{
 			Destructors[static_cast<std::uint32_t>(mType)](mData, mSize-1);
 			--mSize;
+			mIsDirty = true;
 			return true;
 		}
 		return false;
@@ -484,6 +480,7 @@ namespace AnonymousEngine
 			{
 				memmove(&mData.scopeValue[index], &mData.scopeValue[index + 1], (mSize - index - 1) * sizeof(Scope*));
 				--mSize;
+				mIsDirty = true;
 				for (std::uint32_t i = index; i < mSize; ++i)
 				{
 					mData.scopeValue[index]->mParentDatumIndex = i;
@@ -500,6 +497,7 @@ namespace AnonymousEngine
 		ValidateIndex(index);
 		memmove(&mData.scopeValue[index], &mData.scopeValue[index + 1], (mSize - index - 1) * sizeof(Scope*));
 		--mSize;
+		mIsDirty = true;
 		for (std::uint32_t i = index; i < mSize; ++i)
 		{
 			mData.scopeValue[index]->mParentDatumIndex = i;
@@ -544,6 +542,7 @@ namespace AnonymousEngine
 	void Datum::SetFromString(const std::string& stringData, std::uint32_t index)
 	{
 		ValidateIndex(index);
+		mIsDirty = true;
 		Deserializers[static_cast<std::uint32_t>(mType)](stringData, mData, index);
 	}
 
@@ -583,6 +582,7 @@ namespace AnonymousEngine
 			}
 		}
 		mSize = newSize;
+		mIsDirty = true;
 	}
 
 	std::uint32_t Datum::Size() const
@@ -595,6 +595,21 @@ namespace AnonymousEngine
 		return mIsExternal;
 	}
 
+	bool Datum::IsDirty() const
+	{
+		return mIsDirty;
+	}
+
+	void Datum::MarkDirty()
+	{
+		mIsDirty = true;
+	}
+
+	void Datum::ClearDirty()
+	{
+		mIsDirty = false;
+	}
+
 	void Datum::Clear()
 	{
 		if (!mIsExternal)
@@ -607,6 +622,7 @@ namespace AnonymousEngine
 		}
 		mSize = 0;
 		mIsExternal = false;
+		mIsDirty = true;
 		mData.voidPtr = nullptr;
 	}
 
@@ -642,6 +658,7 @@ namespace AnonymousEngine
 	void Datum::InitializeScalar(DatumType type)
 	{
 		SetType(type);
+		mIsDirty = true;
 		if (!mIsExternal)
 		{
 			Resize(1);
@@ -652,6 +669,7 @@ namespace AnonymousEngine
 	{
 		mType = rhs.mType;
 		mIsExternal = rhs.mIsExternal;
+		mIsDirty = true;
 		if (mIsExternal)
 		{
 			mData = rhs.mData;
@@ -673,11 +691,13 @@ namespace AnonymousEngine
 		mData = rhs.mData;
 		mSize = rhs.mSize;
 		mIsExternal = rhs.mIsExternal;
+		mIsDirty = true;
 
 		rhs.mType = DatumType::Unknown;
 		rhs.mData.voidPtr = nullptr;
 		rhs.mSize = 0;
 		rhs.mIsExternal = false;
+		rhs.mIsDirty = true;
 	}
 
 	void Datum::SetExternalStorage(void* externalData, std::uint32_t size, DatumType type)
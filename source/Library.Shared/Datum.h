@@ -345,6 +345,19 @@ namespace AnonymousEngine
 		 */
 		bool IsExternal() const;
 
+		/** Check whether the datum may have changed since its dirty flag was last cleared. Every write through the
+		 *  datum sets the flag, including handing out a writable reference with Get, so the flag can be set without
+		 *  an actual change. Writes to external storage which bypass the datum can't be seen, MarkDirty can report them
+		 *  @return A boolean indicating whether the datum may have changed
+		 */
+		bool IsDirty() const;
+		/** Flag the datum as changed. Used by code which writes to external storage directly
+		 */
+		void MarkDirty();
+		/** Clear the changed flag, usually once the datum is saved
+		 */
+		void ClearDirty();
+
 		/** Clear all the items from the vector
 		 */
 		void Clear();
@@ -370,6 +383,7 @@ namespace AnonymousEngine
 		DatumValue mData;
 		std::uint32_t mSize;
 		bool mIsExternal;
+		bool mIsDirty;
 
 		static const std::uint32_t TypeSizes[static_cast<uint32_t>(DatumType::MaxTypes)];
 		static const std::function<void(DatumValue&, std::uint32_t)> DefaultConstructors[static_cast<uint32_t>(DatumType::MaxTypes)];
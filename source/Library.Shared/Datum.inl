@@ -6,6 +6,7 @@ namespace AnonymousEngine
 	inline std::int32_t& Datum::Get<std::int32_t>(const std::uint32_t index)
 	{
 		ValidateIndex(index);
+		mIsDirty = true;
 		return mData.intValue[index];
 	}
 
@@ -13,6 +14,7 @@ namespace AnonymousEngine
 	inline float& Datum::Get<float>(const std::uint32_t index)
 	{
 		ValidateIndex(index);
+		mIsDirty = true;
 		return mData.floatValue[index];
 	}
 
@@ -20,6 +22,7 @@ namespace AnonymousEngine
 	inline std::string& Datum::Get<std::string>(const std::uint32_t index)
 	{
 		ValidateIndex(index);
+		mIsDirty = true;
 		return mData.strValue[index];
 	}
 
@@ -27,6 +30,7 @@ namespace AnonymousEngine
 	inline glm::mat4& Datum::Get<glm::mat4>(const std::uint32_t index)
 	{
 		ValidateIndex(index);
+		mIsDirty = true;
 		return mData.matValue[index];
 	}
 
@@ -34,6 +38,7 @@ namespace AnonymousEngine
 	inline glm::vec4& Datum::Get<glm::vec4>(const std::uint32_t index)
 	{
 		ValidateIndex(index);
+		mIsDirty = true;
 		return mData.vecValue[index];
 	}
 
@@ -48,37 +53,43 @@ namespace AnonymousEngine
 	inline RTTI*& Datum::Get<RTTI*>(const std::uint32_t index)
 	{
 		ValidateIndex(index);
+		mIsDirty = true;
 		return mData.rttiPtrValue[index];
 	}
 
 	template <>
 	inline const std::int32_t& Datum::Get<std::int32_t>(const std::uint32_t index) const
 	{
-		return const_cast<Datum*>(this)->Get<std::int32_t>(index);
+		ValidateIndex(index);
+		return mData.intValue[index];
 	}
 
 	template <>
 	inline const float& Datum::Get<float>(const std::uint32_t index) const
 	{
-		return const_cast<Datum*>(this)->Get<float>(index);
+		ValidateIndex(index);
+		return mData.floatValue[index];
 	}
 
 	template <>
 	inline const std::string& Datum::Get<std::string>(const std::uint32_t index) const
 	{
-		return const_cast<Datum*>(this)->Get<std::string>(index);
+		ValidateIndex(index);
+		return mData.strValue[index];
 	}
 
 	template <>
 	inline const glm::mat4& Datum::Get<glm::mat4>(const std::uint32_t index) const
 	{
-		return const_cast<Datum*>(this)->Get<glm::mat4>(index);
+		ValidateIndex(index);
+		return mData.matValue[index];
 	}
 
 	template <>
 	inline const glm::vec4& Datum::Get<glm::vec4>(const std::uint32_t index) const
 	{
-		return const_cast<Datum*>(this)->Get<glm::vec4>(index);
+		ValidateIndex(index);
+		return mData.vecValue[index];
 	}
 
 	template <>
@@ -90,6 +101,7 @@ namespace AnonymousEngine
 	template <>
 	inline RTTI* const& Datum::Get<RTTI*>(const std::uint32_t index) const
 	{
-		return const_cast<RTTI*&>(const_cast<Datum*>(this)->Get<RTTI*>(index));
+		ValidateIndex(index);
+		return mData.rttiPtrValue[index];
 	}
 }
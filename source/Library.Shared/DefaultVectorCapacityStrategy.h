@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CapacityStrategy.h"
+#include "VectorGrowthPolicy.h"
 
 namespace AnonymousEngine
 {
@@ -23,14 +24,7 @@ namespace AnonymousEngine
 		*/
 		inline std::uint32_t operator()(std::uint32_t size, std::uint32_t capacity) const override
 		{
-			if (capacity == 0)
-			{
-				return 3;
-			}
-			else
-			{
-				return size;
-			}
+			return GeometricGrowthPolicy()(size, capacity);
 		}
 	};
 }
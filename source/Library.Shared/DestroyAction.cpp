@@ -22,12 +22,12 @@ namespace AnonymousEngine
 			Scope* searchScope = GetParent();
 			while(searchScope != nullptr)
 			{
-				foundDatum = searchScope->Search(ActionsAttributeName, &searchScope);
+				foundDatum = searchScope->Search(ActionsAttributeKey, &searchScope);
 				if (foundDatum != nullptr)
 				{
 					for (std::uint32_t index = 0; index < foundDatum->Size(); ++index)
 					{
-						assert(foundDatum->Get<Scope>(index).Is(Action::TypeIdClass()));
+						assert(foundDatum->Get<Scope>(index).Is<Action>());
 						Action& action = static_cast<Action&>(foundDatum->Get<Scope>(index));
 						if (action.Name() == mInstanceName)
 						{
@@ -34,7 +34,7 @@ namespace AnonymousEngine
 
 		Sector& Entity::GetSector()
 		{
-			assert(GetParent()->Is(Sector::TypeIdClass()));
+			assert(GetParent()->Is<Sector>());
 			return *(static_cast<Sector*>(GetParent()));
 		}
 
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
 #include "EventPublisher.h"
+#include "EventStatistics.h"
+#include "EventSubscriber.h"
 #include "RTTI.h"
 
 namespace AnonymousEngine
@@ -41,24 +47,90 @@ namespace AnonymousEngine
 			 *  @param subscriber The subscriber who wants to subscribe to this event
 			 */
 			static void Subscribe(class EventSubscriber& subscriber);
-			/** Unsubscribe from this event
+			/** Unsubscribe from this event. Can be called while the event is being delivered, in which case the subscriber
+			 *  isn't notified from then on
 			 *  @param subscriber The subscriber who wants to unsubscribe from this event
 			 */
 			static void Unsubscribe(class EventSubscriber& subscriber);
-			/** Unsubscribe all subscribers from this event
+			/** Subscribe a typed callable to this event. On delivery the callable is invoked directly with the message,
+			 *  without going through EventPublisher or any RTTI checks
+			 *  @param callable Any object invocable with a const MessageT&, const or not. The caller owns it and it must
+			 *  outlive the subscription
+			 */
+			template <typename CallableT, typename = std::enable_if_t<!std::is_base_of<EventSubscriber, CallableT>::value && !std::is_function<CallableT>::value>>
+			static void Subscribe(CallableT& callable);
+			/** Unsubscribe a typed callable from this event
+			 *  @param callable The callable which was previously subscribed to this event
+			 */
+			template <typename CallableT, typename = std::enable_if_t<!std::is_base_of<EventSubscriber, CallableT>::value && !std::is_function<CallableT>::value>>
+			static void Unsubscribe(CallableT& callable);
+			/** Subscribe a function to this event. On delivery it is called directly with the message
+			 *  @param function The function to call
+			 */
+			static void Subscribe(void (*function)(const MessageT&));
+			/** Unsubscribe a function from this event
+			 *  @param function The function which was previously subscribed to this event
+			 */
+			static void Unsubscribe(void (*function)(const MessageT&));
+			/** Unsubscribe all subscribers and typed callables from this event
 			 */
 			static void UnsubscribeAll();
 
+			/** Deliver the event to all subscribers and then to all typed callables of this event type. They can subscribe
+			 *  and unsubscribe while it is delivered. The time each of them takes is recorded into the statistics attached
+			 *  to EventPublisher, if any
+			 */
+			void Deliver() override;
+
 			/** Get the message payload
 			 */
 			const MessageT& Message();
 
 		private:
+			// A type erased callable which is invoked with the message directly. It is either an object, whose address is
+			// stored without its constness, or a function. A delegate without an invoker is an unsubscribed entry
+			struct Delegate
+			{
+				void* mCallable;
+				void (*mFunction)(const MessageT& message);
+				void (*mInvoke)(const Delegate& delegate, const MessageT& message);
+
+				// The address the statistics of the delegate are recorded against
+				const void* Key() const;
+
+				bool operator==(const Delegate& rhs) const;
+				bool operator!=(const Delegate& rhs) const;
+			};
+
+			// Makes the delegate of a callable object, which may be const
+			template <typename CallableT>
+			static Delegate MakeDelegate(CallableT& callable);
+			// Makes the delegate of a function
+			static Delegate MakeDelegate(void (*function)(const MessageT&));
+			// Invokes the callable object of the given type, restoring its constness
+			template <typename CallableT>
+			static void Invoke(const Delegate& delegate, const MessageT& message);
+			// Calls the function of a delegate
+			static void InvokeFunction(const Delegate& delegate, const MessageT& message);
+			// Removes a delegate from the list, or nulls it out if the event is being delivered
+			static void RemoveDelegate(const Delegate& delegate);
+			// Invokes every typed callable, timing them if statistics are attached
+			void DeliverToDelegates();
+			// Removes the subscribers and callables unsubscribed during delivery, once the outermost delivery is done
+			static void EndDelivery();
+
 			// Message payload
 			const MessageT& mMessage;
 
 			// List of all subscribers to this event type
 			static Vector<EventSubscriber*> Subscribers;
+			// List of all typed callables subscribed to this event type
+			static Vector<Delegate> Delegates;
+			// Number of deliveries of this event type in progress. While there are any, unsubscribing nulls entries out
+			// instead of removing them, so the lists being walked don't shift
+			static std::uint32_t DeliveryDepth;
+			// Whether entries were nulled out during the deliveries in progress
+			static bool HasDeferredRemovals;
 
 			RTTI_DECLARATIONS(Event, EventPublisher)
 		};
@@ -9,6 +9,15 @@ namespace AnonymousEngine
 		template <typename MessageT>
 		Vector<EventSubscriber*> Event<MessageT>::Subscribers = Vector<EventSubscriber*>();
 
+		template <typename MessageT>
+		Vector<typename Event<MessageT>::Delegate> Event<MessageT>::Delegates = Vector<typename Event<MessageT>::Delegate>();
+
+		template <typename MessageT>
+		std::uint32_t Event<MessageT>::DeliveryDepth = 0U;
+
+		template <typename MessageT>
+		bool Event<MessageT>::HasDeferredRemovals = false;
+
 		template <typename MessageT>
 		Event<MessageT>::Event(const MessageT& message) :
 			EventPublisher(Subscribers), mMessage(message)
@@ -52,13 +61,142 @@ namespace AnonymousEngine
 		template <typename MessageT>
 		void Event<MessageT>::Unsubscribe(EventSubscriber& subscriber)
 		{
-			Subscribers.Remove(&subscriber);
+			if (DeliveryDepth == 0)
+			{
+				Subscribers.Remove(&subscriber);
+				return;
+			}
+			for (std::uint32_t index = 0; index < Subscribers.Size(); ++index)
+			{
+				if (Subscribers[index] == &subscriber)
+				{
+					Subscribers[index] = nullptr;
+					HasDeferredRemovals = true;
+					break;
+				}
+			}
+		}
+
+		template <typename MessageT>
+		template <typename CallableT, typename>
+		void Event<MessageT>::Subscribe(CallableT& callable)
+		{
+			Delegates.PushBack(MakeDelegate(callable));
+		}
+
+		template <typename MessageT>
+		template <typename CallableT, typename>
+		void Event<MessageT>::Unsubscribe(CallableT& callable)
+		{
+			RemoveDelegate(MakeDelegate(callable));
+		}
+
+		template <typename MessageT>
+		void Event<MessageT>::Subscribe(void (*function)(const MessageT&))
+		{
+			Delegates.PushBack(MakeDelegate(function));
+		}
+
+		template <typename MessageT>
+		void Event<MessageT>::Unsubscribe(void (*function)(const MessageT&))
+		{
+			RemoveDelegate(MakeDelegate(function));
+		}
+
+		template <typename MessageT>
+		void Event<MessageT>::RemoveDelegate(const Delegate& delegate)
+		{
+			if (DeliveryDepth == 0)
+			{
+				Delegates.Remove(delegate);
+				return;
+			}
+			for (std::uint32_t index = 0; index < Delegates.Size(); ++index)
+			{
+				if (Delegates[index] == delegate)
+				{
+					Delegates[index] = Delegate();
+					HasDeferredRemovals = true;
+					break;
+				}
+			}
 		}
 
 		template <typename MessageT>
 		void Event<MessageT>::UnsubscribeAll()
 		{
-			Subscribers.Clear();
+			if (DeliveryDepth == 0)
+			{
+				Subscribers.Clear();
+				Delegates.Clear();
+				return;
+			}
+			for (std::uint32_t index = 0; index < Subscribers.Size(); ++index)
+			{
+				Subscribers[index] = nullptr;
+			}
+			for (std::uint32_t index = 0; index < Delegates.Size(); ++index)
+			{
+				Delegates[index] = Delegate();
+			}
+			HasDeferredRemovals = true;
+		}
+
+		template <typename MessageT>
+		void Event<MessageT>::Deliver()
+		{
+			++DeliveryDepth;
+			try
+			{
+				EventPublisher::Deliver();
+				DeliverToDelegates();
+			}
+			catch (...)
+			{
+				EndDelivery();
+				throw;
+			}
+			EndDelivery();
+		}
+
+		template <typename MessageT>
+		void Event<MessageT>::DeliverToDelegates()
+		{
+			// callables can subscribe while invoked, which may move the list, so every delegate is copied out first
+			EventStatistics* statistics = CurrentStatistics();
+			for (std::uint32_t index = 0; index < Delegates.Size(); ++index)
+			{
+				Delegate delegate = Delegates.Data()[index];
+				if (delegate.mInvoke == nullptr)
+				{
+					continue;
+				}
+				if (statistics == nullptr)
+				{
+					delegate.mInvoke(delegate, mMessage);
+					continue;
+				}
+
+				std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+				delegate.mInvoke(delegate, mMessage);
+				statistics->RecordInvoke(delegate.Key(), std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start));
+			}
+		}
+
+		template <typename MessageT>
+		void Event<MessageT>::EndDelivery()
+		{
+			if (--DeliveryDepth > 0 || !HasDeferredRemovals)
+			{
+				return;
+			}
+			while (Subscribers.Remove(nullptr))
+			{
+			}
+			while (Delegates.Remove(Delegate()))
+			{
+			}
+			HasDeferredRemovals = false;
 		}
 
 		template <typename MessageT>
@@ -66,5 +204,56 @@ namespace AnonymousEngine
 		{
 			return mMessage;
 		}
+
+		template <typename MessageT>
+		template <typename CallableT>
+		typename Event<MessageT>::Delegate Event<MessageT>::MakeDelegate(CallableT& callable)
+		{
+			Delegate delegate = Delegate();
+			delegate.mCallable = const_cast<void*>(static_cast<const void*>(std::addressof(callable)));
+			delegate.mInvoke = &Invoke<CallableT>;
+			return delegate;
+		}
+
+		template <typename MessageT>
+		typename Event<MessageT>::Delegate Event<MessageT>::MakeDelegate(void (*function)(const MessageT&))
+		{
+			Delegate delegate = Delegate();
+			delegate.mFunction = function;
+			delegate.mInvoke = &InvokeFunction;
+			return delegate;
+		}
+
+		template <typename MessageT>
+		template <typename CallableT>
+		void Event<MessageT>::Invoke(const Delegate& delegate, const MessageT& message)
+		{
+			(*static_cast<CallableT*>(delegate.mCallable))(message);
+		}
+
+		template <typename MessageT>
+		void Event<MessageT>::InvokeFunction(const Delegate& delegate, const MessageT& message)
+		{
+			delegate.mFunction(message);
+		}
+
+		template <typename MessageT>
+		const void* Event<MessageT>::Delegate::Key() const
+		{
+			// functions are told apart by their address, which the supported compilers convert to a data pointer
+			return (mCallable != nullptr) ? mCallable : reinterpret_cast<const void*>(mFunction);
+		}
+
+		template <typename MessageT>
+		bool Event<MessageT>::Delegate::operator==(const Delegate& rhs) const
+		{
+			return (mCallable == rhs.mCallable && mFunction == rhs.mFunction && mInvoke == rhs.mInvoke);
+		}
+
+		template <typename MessageT>
+		bool Event<MessageT>::Delegate::operator!=(const Delegate& rhs) const
+		{
+			return !(*this == rhs);
+		}
 	}
 }
@@ -1,12 +1,18 @@
 #include "EventPublisher.h"
+#include <chrono>
+#include "EventStatistics.h"
 #include "EventSubscriber.h"
 
 namespace AnonymousEngine
 {
 	namespace Core
 	{
+		using namespace std::chrono;
+
 		RTTI_DEFINITIONS(EventPublisher)
 
+		EventStatistics* EventPublisher::Statistics = nullptr;
+
 		EventPublisher::EventPublisher(const Vector<class EventSubscriber*>& subscriberList) :
 			mSubscribers(subscriberList)
 		{
@@ -14,10 +20,42 @@ namespace AnonymousEngine
 
 		void EventPublisher::Deliver()
 		{
-			for (auto& subscriber : mSubscribers)
+			// subscribers can subscribe while notified, which may move the list, so the size and the data are read every
+			// time. Ones which unsubscribe are nulled out rather than removed, so no one else is skipped
+			if (Statistics == nullptr)
+			{
+				for (std::uint32_t index = 0; index < mSubscribers.Size(); ++index)
+				{
+					EventSubscriber* subscriber = mSubscribers.Data()[index];
+					if (subscriber != nullptr)
+					{
+						subscriber->Notify(*this);
+					}
+				}
+				return;
+			}
+
+			for (std::uint32_t index = 0; index < mSubscribers.Size(); ++index)
 			{
+				EventSubscriber* subscriber = mSubscribers.Data()[index];
+				if (subscriber == nullptr)
+				{
+					continue;
+				}
+				high_resolution_clock::time_point start = high_resolution_clock::now();
 				subscriber->Notify(*this);
+				Statistics->RecordNotify(subscriber, duration_cast<nanoseconds>(high_resolution_clock::now() - start));
 			}
 		}
+
+		void EventPublisher::SetStatistics(EventStatistics* statistics)
+		{
+			Statistics = statistics;
+		}
+
+		EventStatistics* EventPublisher::CurrentStatistics()
+		{
+			return Statistics;
+		}
 	}
 }
@@ -14,8 +14,18 @@ namespace AnonymousEngine
 		public:
 			/** Deliver the event with the message payload to all subscribers of this event type
 			 */
-			void Deliver();
+			virtual void Deliver();
+
+			/** Attach a statistics instance which records the time each subscriber spends in Notify
+			 *  @param statistics The statistics to record into. Pass nullptr to stop recording
+			 */
+			static void SetStatistics(class EventStatistics* statistics);
 		protected:
+			/** Get the statistics attached with SetStatistics
+			 *  @return The statistics to record into, or nullptr if nothing is recorded
+			 */
+			static class EventStatistics* CurrentStatistics();
+
 			/** Initialize the publisher instance
 			 *  @param subscriberList The list of subscribers. This will be the address of a static list inside custom event class
 			 */
@@ -38,9 +48,13 @@ namespace AnonymousEngine
 			 */
 			EventPublisher& operator=(EventPublisher&& rhs) noexcept = default;
 		private:
-			// This list is initialized during the constructor
+			// This list is initialized during the constructor. Subscribers unsubscribed during delivery are left as null
+			// until it is done
 			const Vector<class EventSubscriber*>& mSubscribers;
 
+			// Statistics shared by all publishers. Nothing is recorded when this is null
+			static class EventStatistics* Statistics;
+
 			RTTI_DECLARATIONS(EventPublisher, RTTI);
 		};
 	}
@@ -1,4 +1,5 @@
 #include "EventQueue.h"
+#include "EventStatistics.h"
 
 namespace AnonymousEngine
 {
@@ -8,17 +9,36 @@ namespace AnonymousEngine
 
 		#pragma region EventQueueMethods
 
+		EventQueue::EventQueue() :
+			mEventQueue(), mStatistics(nullptr)
+		{
+		}
+
 		void EventQueue::Enqueue(const std::shared_ptr<EventPublisher>& publisher, const GameTime& gameTime, std::uint32_t delay)
 		{
-			mEventQueue.PushBack({publisher, gameTime.CurrentTime(), std::chrono::milliseconds(delay)});
+			mEventQueue.PushBack({publisher, gameTime.TotalGameTime(), milliseconds(delay)});
+			if (mStatistics != nullptr)
+			{
+				mStatistics->RecordEnqueue(publisher->TypeIdInstance(), mEventQueue.Size());
+			}
 		}
 
 		void EventQueue::Update(const GameTime& gameTime)
 		{
 			std::uint32_t expiredStart = Partition(gameTime);
+			if (mStatistics != nullptr)
+			{
+				mStatistics->RecordQueueDepth(mEventQueue.Size());
+			}
 			for (std::uint32_t index = expiredStart; index < mEventQueue.Size(); ++index)
 			{
-				mEventQueue[index].mPublisher->Deliver();
+				QueueEntry& entry = mEventQueue[index];
+				if (mStatistics != nullptr)
+				{
+					auto latency = duration_cast<microseconds>(gameTime.TotalGameTime() - (entry.mEnqueuedTime + entry.mDelay));
+					mStatistics->RecordDelivery(entry.mPublisher->TypeIdInstance(), latency);
+				}
+				entry.mPublisher->Deliver();
 			}
 			mEventQueue.Remove(mEventQueue.IteratorAt(expiredStart), mEventQueue.end());
 		}
@@ -38,6 +58,11 @@ namespace AnonymousEngine
 			return mEventQueue.Size();
 		}
 
+		void EventQueue::SetStatistics(EventStatistics* statistics)
+		{
+			mStatistics = statistics;
+		}
+
 		void EventQueue::Send(const std::shared_ptr<EventPublisher>& publisher)
 		{
 			publisher->Deliver();
@@ -49,7 +74,7 @@ namespace AnonymousEngine
 			for (std::uint32_t index = 0; index < upperNonExpiredIndex; ++index)
 			{
 				auto& entry = mEventQueue[index];
-				if ((entry.mEnqueuedTime + entry.mDelay) <= gameTime.CurrentTime())
+				if ((entry.mEnqueuedTime + entry.mDelay) <= gameTime.TotalGameTime())
 				{
 					--upperNonExpiredIndex;
 					if (index != upperNonExpiredIndex)
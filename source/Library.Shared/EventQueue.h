@@ -14,10 +14,15 @@ namespace AnonymousEngine
 		class EventQueue final
 		{
 		public:
-			/** Add an event to the queue
+			/** Initialize an empty event queue
+			 */
+			EventQueue();
+
+			/** Add an event to the queue. Expiry is measured in game time (GameTime::TotalGameTime), not wall clock time,
+			 *  so the queue behaves identically when the simulation is stepped with a fixed timestep
 			 *  @param publisher The event publisher to be enqueued
 			 *  @param gameTime The time at which the event is being enqueued
-			 *  @param delay The number of milliseconds after which this event is to be delivered
+			 *  @param delay The number of milliseconds of game time after which this event is to be delivered
 			 */
 			void Enqueue(const std::shared_ptr<EventPublisher>& publisher, const GameTime& gameTime, std::uint32_t delay);
 
@@ -39,6 +44,11 @@ namespace AnonymousEngine
 			 */
 			std::uint32_t Size() const;
 
+			/** Attach a statistics instance which records enqueue counts, queue depth and delivery latency of this queue
+			 *  @param statistics The statistics to record into. Pass nullptr to stop recording
+			 */
+			void SetStatistics(class EventStatistics* statistics);
+
 			/** Deliver the given event publisher
 			 *  @param publisher The event to publish
 			 */
@@ -48,7 +58,7 @@ namespace AnonymousEngine
 			struct QueueEntry
 			{
 				std::shared_ptr<EventPublisher> mPublisher;
-				std::chrono::high_resolution_clock::time_point mEnqueuedTime;
+				std::chrono::milliseconds mEnqueuedTime;
 				std::chrono::milliseconds mDelay;
 			};
 
@@ -57,6 +67,9 @@ namespace AnonymousEngine
 
 			// The event queue
 			Vector<QueueEntry> mEventQueue;
+
+			// Statistics of this queue. Nothing is recorded when this is null
+			class EventStatistics* mStatistics;
 		};
 	}
 }
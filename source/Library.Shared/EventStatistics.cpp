@@ -0,0 +1,78 @@
+#include "EventStatistics.h"
+
+namespace AnonymousEngine
+{
+	namespace Core
+	{
+		EventStatistics::EventTypeStatistics::EventTypeStatistics() :
+			mEnqueueCount(0), mDeliveryCount(0), mDeliveryLatency()
+		{
+		}
+
+		EventStatistics::EventStatistics() :
+			mEventTypes(), mSubscribers(), mCallables(), mQueueDepth()
+		{
+		}
+
+		void EventStatistics::RecordEnqueue(std::uint64_t eventTypeId, std::uint32_t queueDepth)
+		{
+			++mEventTypes[eventTypeId].mEnqueueCount;
+			mQueueDepth.Record(queueDepth);
+		}
+
+		void EventStatistics::RecordQueueDepth(std::uint32_t queueDepth)
+		{
+			mQueueDepth.Record(queueDepth);
+		}
+
+		void EventStatistics::RecordDelivery(std::uint64_t eventTypeId, const std::chrono::microseconds& latency)
+		{
+			EventTypeStatistics& statistics = mEventTypes[eventTypeId];
+			++statistics.mDeliveryCount;
+			statistics.mDeliveryLatency.Record(static_cast<std::uint64_t>(latency.count()));
+		}
+
+		void EventStatistics::RecordNotify(const EventSubscriber* subscriber, const std::chrono::nanoseconds& duration)
+		{
+			mSubscribers[subscriber].Record(static_cast<std::uint64_t>(duration.count()));
+		}
+
+		void EventStatistics::RecordInvoke(const void* callable, const std::chrono::nanoseconds& duration)
+		{
+			mCallables[callable].Record(static_cast<std::uint64_t>(duration.count()));
+		}
+
+		const EventStatistics::EventTypeMap& EventStatistics::EventTypes() const
+		{
+			return mEventTypes;
+		}
+
+		const EventStatistics::SubscriberMap& EventStatistics::Subscribers() const
+		{
+			return mSubscribers;
+		}
+
+		const EventStatistics::CallableMap& EventStatistics::Callables() const
+		{
+			return mCallables;
+		}
+
+		const Histogram& EventStatistics::QueueDepth() const
+		{
+			return mQueueDepth;
+		}
+
+		EventStatistics EventStatistics::Snapshot() const
+		{
+			return EventStatistics(*this);
+		}
+
+		void EventStatistics::Reset()
+		{
+			mEventTypes.Clear();
+			mSubscribers.Clear();
+			mCallables.Clear();
+			mQueueDepth.Reset();
+		}
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include "HashMap.h"
+#include "Histogram.h"
+
+namespace AnonymousEngine
+{
+	namespace Core
+	{
+		class EventSubscriber;
+
+		/** Records counters and histograms about the event system. An instance can be attached to EventQueue instances
+		 *  and to EventPublisher, which then report enqueues, queue depth, delivery latency and the time every subscriber
+		 *  and typed callable spends handling an event into it
+		 */
+		class EventStatistics final
+		{
+		public:
+			/** Statistics recorded per event type
+			 */
+			struct EventTypeStatistics
+			{
+				/** Number of events of this type that were enqueued
+				 */
+				std::uint64_t mEnqueueCount;
+				/** Number of events of this type that were delivered from a queue
+				 */
+				std::uint64_t mDeliveryCount;
+				/** How late the events were delivered, in microseconds, relative to their enqueued time plus delay
+				 */
+				Histogram mDeliveryLatency;
+
+				/** Initialize all counters to zero
+				 */
+				EventTypeStatistics();
+			};
+
+			typedef HashMap<std::uint64_t, EventTypeStatistics> EventTypeMap;
+			typedef HashMap<const EventSubscriber*, Histogram> SubscriberMap;
+			typedef HashMap<const void*, Histogram> CallableMap;
+
+			/** Initialize an empty statistics instance
+			 */
+			EventStatistics();
+			/** Release any allocated resources
+			 */
+			~EventStatistics() = default;
+
+			/** Default copy constructor
+			 */
+			EventStatistics(const EventStatistics& rhs) = default;
+			/** Default copy assignment operator
+			 */
+			EventStatistics& operator=(const EventStatistics& rhs) = default;
+
+			/** Record that an event was enqueued
+			 *  @param eventTypeId The type id of the enqueued event
+			 *  @param queueDepth The size of the queue after the event was enqueued
+			 */
+			void RecordEnqueue(std::uint64_t eventTypeId, std::uint32_t queueDepth);
+			/** Record the depth of a queue
+			 *  @param queueDepth The number of events in the queue
+			 */
+			void RecordQueueDepth(std::uint32_t queueDepth);
+			/** Record that a queued event was delivered
+			 *  @param eventTypeId The type id of the delivered event
+			 *  @param latency The time between the event expiring and it actually being delivered
+			 */
+			void RecordDelivery(std::uint64_t eventTypeId, const std::chrono::microseconds& latency);
+			/** Record the time a subscriber spent in its Notify
+			 *  @param subscriber The subscriber that was notified
+			 *  @param duration The time spent inside Notify
+			 */
+			void RecordNotify(const EventSubscriber* subscriber, const std::chrono::nanoseconds& duration);
+			/** Record the time a typed callable subscribed to an event spent handling it
+			 *  @param callable The address of the callable that was invoked
+			 *  @param duration The time spent inside the callable
+			 */
+			void RecordInvoke(const void* callable, const std::chrono::nanoseconds& duration);
+
+			/** Get the statistics of all the event types seen so far, keyed by type id
+			 *  @return The per event type statistics
+			 */
+			const EventTypeMap& EventTypes() const;
+			/** Get the notify time histograms (in nanoseconds) of all subscribers seen so far
+			 *  @return The per subscriber notify time histograms
+			 */
+			const SubscriberMap& Subscribers() const;
+			/** Get the invoke time histograms (in nanoseconds) of all typed callables seen so far, keyed by their address
+			 *  @return The per callable invoke time histograms
+			 */
+			const CallableMap& Callables() const;
+			/** Get the histogram of sampled queue depths
+			 *  @return The queue depth histogram
+			 */
+			const Histogram& QueueDepth() const;
+
+			/** Take a copy of all the statistics recorded till now
+			 *  @return A copy of the current statistics
+			 */
+			EventStatistics Snapshot() const;
+			/** Clear all the recorded statistics
+			 */
+			void Reset();
+
+		private:
+			EventTypeMap mEventTypes;
+			SubscriberMap mSubscribers;
+			CallableMap mCallables;
+			Histogram mQueueDepth;
+		};
+	}
+}
@@ -1,18 +1,19 @@
 #pragma once
 
 #include <string>
-#include "HashMap.h"
+#include "ConcurrentHashMap.h"
 #include "RTTI.h"
 
 namespace AnonymousEngine
 {
 	/** This class is a templated abstract factory class.
 	 *  There are macros defined which lets the user create custom factories
+	 *  Factories can be found and products created from any thread, also while other factories are being registered
 	 */
 	template <typename AbstractProductT>
 	class Factory : public RTTI
 	{
-		typedef HashMap<std::string, Factory<AbstractProductT>*> FactoryMap;
+		typedef ConcurrentHashMap<std::string, Factory<AbstractProductT>*> FactoryMap;
 	public:
 		typedef typename FactoryMap::Iterator FactoryIterator;
 
@@ -36,7 +37,7 @@ namespace AnonymousEngine
 		 */
 		static AbstractProductT* Create(const std::string& name);
 		
-		/** Gets the begining of the factories list
+		/** Gets the begining of the factories list. Iterating isn't safe while factories are being added or removed
 		 *  @return The begin iterator of the factories list
 		 */
 		static FactoryIterator begin();
@@ -47,6 +48,7 @@ namespace AnonymousEngine
 		
 		/** Register a factory against a product name
 		 *  @param factory The factory which is to be registered
+		 *  @exception std::runtime_error Thrown if a factory of a different type is registered for the same name
 		 */
 		static void Add(Factory<AbstractProductT>& factory);
 		/** Remove a factory against a product name
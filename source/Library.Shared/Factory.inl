@@ -5,24 +5,23 @@ namespace AnonymousEngine
 	RTTI_DEFINITIONS(Factory<AbstractProductT>)
 
 	template <typename AbstractProductT>
-	typename Factory<AbstractProductT>::FactoryMap Factory<AbstractProductT>::Factories = Factory<AbstractProductT>::FactoryMap();
+	typename Factory<AbstractProductT>::FactoryMap Factory<AbstractProductT>::Factories;
 
 	template <typename AbstractProductT>
 	Factory<AbstractProductT>* Factory<AbstractProductT>::Find(const std::string& name)
 	{
-		if (Factories.ContainsKey(name))
-		{
-			return Factories[name];
-		}
-		return nullptr;
+		Factory<AbstractProductT>* factory = nullptr;
+		Factories.Find(name, factory);
+		return factory;
 	}
 
 	template <typename AbstractProductT>
 	AbstractProductT* Factory<AbstractProductT>::Create(const std::string& name)
 	{
-		if (Factories.ContainsKey(name))
+		Factory<AbstractProductT>* factory = Find(name);
+		if (factory != nullptr)
 		{
-			return Factories[name]->Create();
+			return factory->Create();
 		}
 		throw std::runtime_error("Not configured to create product : " + name);
 	}
@@ -43,11 +42,15 @@ namespace AnonymousEngine
 	void Factory<AbstractProductT>::Add(Factory<AbstractProductT>& factory)
 	{
 		std::string className = factory.ClassName();
-		if (Factories.ContainsKey(className) && !factory.Is(Factories[className]->TypeIdInstance()))
+		// checked and replaced under one lock, so two threads registering the same name can't both pass the check
+		Factories.Update(className, [&factory, &className](Factory<AbstractProductT>*& registered)
 		{
-			throw std::runtime_error("A factory of different type is already registered for class name = " + className);
-		}
-		Factories[className] = &factory;
+			if (registered != nullptr && !factory.Is(registered->TypeIdInstance()))
+			{
+				throw std::runtime_error("A factory of different type is already registered for class name = " + className);
+			}
+			registered = &factory;
+		});
 	}
 
 	template <typename AbstractProductT>
@@ -6,7 +6,7 @@ namespace AnonymousEngine
 	using namespace std::chrono;
 
     GameClock::GameClock() :
-		mStartTime(), mCurrentTime(), mLastTime()
+		mStartTime(), mCurrentTime(), mLastTime(), mAccumulatedTime(0)
     {
         Reset();
     }
@@ -31,6 +31,7 @@ namespace AnonymousEngine
 		mStartTime = high_resolution_clock::now();
         mCurrentTime = mStartTime;
         mLastTime = mCurrentTime;
+		mAccumulatedTime = high_resolution_clock::duration(0);
     }
 
     void GameClock::UpdateGameTime(GameTime& gameTime)
@@ -42,4 +43,40 @@ namespace AnonymousEngine
 		gameTime.SetElapsedGameTime(duration_cast<milliseconds>(mCurrentTime - mLastTime));
         mLastTime = mCurrentTime;
     }
+
+	void GameClock::Accumulate()
+	{
+		mCurrentTime = high_resolution_clock::now();
+		Accumulate(mCurrentTime - mLastTime);
+		mLastTime = mCurrentTime;
+	}
+
+	void GameClock::Accumulate(const high_resolution_clock::duration& elapsedTime)
+	{
+		mAccumulatedTime += elapsedTime;
+	}
+
+	const high_resolution_clock::duration& GameClock::AccumulatedTime() const
+	{
+		return mAccumulatedTime;
+	}
+
+	bool GameClock::FixedStep(GameTime& gameTime, const milliseconds& step)
+	{
+		if (step.count() <= 0 || mAccumulatedTime < step)
+		{
+			return false;
+		}
+
+		mAccumulatedTime -= step;
+		StepGameTime(gameTime, step);
+		return true;
+	}
+
+	void GameClock::StepGameTime(GameTime& gameTime, const milliseconds& step) const
+	{
+		gameTime.SetTotalGameTime(gameTime.TotalGameTime() + step);
+		gameTime.SetElapsedGameTime(step);
+		gameTime.SetCurrentTime(mStartTime + gameTime.TotalGameTime());
+	}
 }
@@ -20,9 +20,35 @@ namespace AnonymousEngine
         void Reset();
         void UpdateGameTime(GameTime& gameTime);
 
+		/** Add the wall clock time passed since the last call to the fixed timestep accumulator
+		 */
+		void Accumulate();
+		/** Add a given amount of time to the fixed timestep accumulator, such as the frame time of a recorded session
+		 *  @param elapsedTime The time to add
+		 */
+		void Accumulate(const std::chrono::high_resolution_clock::duration& elapsedTime);
+		/** The time accumulated and not yet consumed by fixed steps. It carries over to the next frame
+		 *  @return The accumulated time
+		 */
+		const std::chrono::high_resolution_clock::duration& AccumulatedTime() const;
+		/** Advance the game time by one fixed step if enough wall clock time has been accumulated.
+		 *  Call this in a loop after Accumulate and update the simulation once for every step taken
+		 *  @param gameTime The game time to advance
+		 *  @param step The fixed timestep
+		 *  @return True if the game time was advanced, false if less than a step is accumulated
+		 */
+		bool FixedStep(GameTime& gameTime, const std::chrono::milliseconds& step);
+		/** Advance the game time by one fixed step without consulting the wall clock. Total game time becomes a pure
+		 *  function of the number of steps taken, which makes replays and faster than real time simulation possible
+		 *  @param gameTime The game time to advance
+		 *  @param step The fixed timestep
+		 */
+		void StepGameTime(GameTime& gameTime, const std::chrono::milliseconds& step) const;
+
     private:
         std::chrono::high_resolution_clock::time_point mStartTime;
 		std::chrono::high_resolution_clock::time_point mCurrentTime;
 		std::chrono::high_resolution_clock::time_point mLastTime;
+		std::chrono::high_resolution_clock::duration mAccumulatedTime;
     };
 }
@@ -1,6 +1,13 @@
 
 #include "HashFunctors.h"
 #include <cstring>
+#if defined(_M_X64)
+#include <intrin.h>
+#endif
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define HASH_FUNCTIONS_SSE2
+#endif
 
 namespace AnonymousEngine
 {
@@ -59,17 +66,191 @@ namespace AnonymousEngine
 		return hash;
 	}
 
+	constexpr uint64_t HashFunctions::FastHashSecret[4];
+
+	// The constants are shared with ConstantHash, which has to give the same hashes
+	static const uint64_t* const Secret = HashFunctions::FastHashSecret;
+	static const uint32_t StripeSize = HashFunctions::FastHashStripeSize;
+	static const uint32_t StripesPerScramble = HashFunctions::FastHashStripesPerScramble;
+	static const uint64_t ScramblePrime = HashFunctions::FastHashScramblePrime;
+
+	static inline uint64_t Read64(const int8_t* data)
+	{
+		uint64_t value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	static inline uint64_t Read32(const int8_t* data)
+	{
+		uint32_t value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	// Multiply into 128 bits and fold the halves together
+	static inline uint64_t Multiply(uint64_t lhs, uint64_t rhs)
+	{
+#if defined(_M_X64)
+		uint64_t high;
+		uint64_t low = _umul128(lhs, rhs, &high);
+		return low ^ high;
+#elif defined(__SIZEOF_INT128__)
+		unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+		return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+		uint64_t lowLow = (lhs & 0xffffffffULL) * (rhs & 0xffffffffULL);
+		uint64_t highLow = (lhs >> 32) * (rhs & 0xffffffffULL);
+		uint64_t lowHigh = (lhs & 0xffffffffULL) * (rhs >> 32);
+		uint64_t cross = (lowLow >> 32) + (highLow & 0xffffffffULL) + lowHigh;
+		uint64_t low = (cross << 32) | (lowLow & 0xffffffffULL);
+		uint64_t high = (highLow >> 32) + (cross >> 32) + (lhs >> 32) * (rhs >> 32);
+		return low ^ high;
+#endif
+	}
+
+	static inline uint32_t Finalize(uint64_t hash)
+	{
+		hash = Multiply(hash ^ Secret[0], Secret[1]);
+		return static_cast<uint32_t>(hash ^ (hash >> 32));
+	}
+
+#ifdef HASH_FUNCTIONS_SSE2
+	// Accumulate one stripe, two lanes per register. Each lane adds the product of the halves of its word mixed with
+	// the secret, and the raw word of its neighbour so no input bits are lost when a half is zero
+	static inline void AccumulateStripe(__m128i* accumulators, const int8_t* data)
+	{
+		for (uint32_t index = 0; index < 2; ++index)
+		{
+			__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + index);
+			__m128i key = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Secret) + index));
+			__m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+			__m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+			accumulators[index] = _mm_add_epi64(accumulators[index], _mm_add_epi64(product, swapped));
+		}
+	}
+
+	static inline void Scramble(__m128i* accumulators)
+	{
+		__m128i prime = _mm_set1_epi32(static_cast<int>(ScramblePrime));
+		for (uint32_t index = 0; index < 2; ++index)
+		{
+			__m128i value = _mm_xor_si128(accumulators[index], _mm_srli_epi64(accumulators[index], 47));
+			__m128i low = _mm_mul_epu32(value, prime);
+			__m128i high = _mm_mul_epu32(_mm_srli_epi64(value, 32), prime);
+			accumulators[index] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+		}
+	}
+
+	static void AccumulateLong(uint64_t* lanes, const int8_t* data, uint32_t length)
+	{
+		__m128i accumulators[2] = { _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes) + 1) };
+		uint32_t stripes = (length - 1) / StripeSize;
+		for (uint32_t stripe = 0; stripe < stripes; ++stripe)
+		{
+			AccumulateStripe(accumulators, data + stripe * StripeSize);
+			if (stripe % StripesPerScramble == StripesPerScramble - 1)
+			{
+				Scramble(accumulators);
+			}
+		}
+		AccumulateStripe(accumulators, data + length - StripeSize);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), accumulators[0]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes) + 1, accumulators[1]);
+	}
+#else
+	static inline void AccumulateStripe(uint64_t* lanes, const int8_t* data)
+	{
+		for (uint32_t index = 0; index < 4; ++index)
+		{
+			uint64_t value = Read64(data + index * sizeof(uint64_t));
+			uint64_t key = value ^ Secret[index];
+			lanes[index ^ 1] += value;
+			lanes[index] += (key & 0xffffffffULL) * (key >> 32);
+		}
+	}
+
+	static inline void Scramble(uint64_t* lanes)
+	{
+		for (uint32_t index = 0; index < 4; ++index)
+		{
+			lanes[index] = (lanes[index] ^ (lanes[index] >> 47)) * ScramblePrime;
+		}
+	}
+
+	static void AccumulateLong(uint64_t* lanes, const int8_t* data, uint32_t length)
+	{
+		uint32_t stripes = (length - 1) / StripeSize;
+		for (uint32_t stripe = 0; stripe < stripes; ++stripe)
+		{
+			AccumulateStripe(lanes, data + stripe * StripeSize);
+			if (stripe % StripesPerScramble == StripesPerScramble - 1)
+			{
+				Scramble(lanes);
+			}
+		}
+		AccumulateStripe(lanes, data + length - StripeSize);
+	}
+#endif
+
+	uint32_t HashFunctions::FastHash(const int8_t* data, uint32_t length)
+	{
+		if (length == 0 || data == nullptr)
+		{
+			return 0;
+		}
+
+		uint64_t hash;
+		if (length <= 16)
+		{
+			// read the key as two words made of overlapping parts, like wyhash
+			uint64_t first;
+			uint64_t second;
+			if (length >= 4)
+			{
+				uint32_t middle = (length >> 3) << 2;
+				first = (Read32(data) << 32) | Read32(data + middle);
+				second = (Read32(data + length - 4) << 32) | Read32(data + length - 4 - middle);
+			}
+			else
+			{
+				const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+				first = (static_cast<uint64_t>(bytes[0]) << 16) | (static_cast<uint64_t>(bytes[length >> 1]) << 8) | bytes[length - 1];
+				second = 0;
+			}
+			hash = Multiply(first ^ Secret[1], second ^ Secret[0]);
+		}
+		else if (length <= StripeSize)
+		{
+			hash = Multiply(Read64(data) ^ Secret[1], Read64(data + 8) ^ Secret[2]);
+			hash ^= Multiply(Read64(data + length - 16) ^ Secret[3], Read64(data + length - 8) ^ Secret[0]);
+		}
+		else
+		{
+			uint64_t lanes[4] = { Secret[0], Secret[1], Secret[2], Secret[3] };
+			AccumulateLong(lanes, data, length);
+			hash = Multiply(lanes[0] ^ Secret[2], lanes[1] ^ Secret[3]);
+			hash += Multiply(lanes[2] ^ Secret[0], lanes[3] ^ Secret[1]);
+		}
+		return Finalize(hash ^ (length * Secret[3]));
+	}
+
 	std::uint32_t DefaultHashFunctor<const char*>::operator()(const char* data) const
 	{
 		if (data == nullptr)
 		{
 			return 0U;
 		}
-		return HashFunctions::SuperFastHash(reinterpret_cast<const int8_t*>(data), static_cast<std::uint32_t>(strlen(data)));
+		return HashFunctions::FastHash(reinterpret_cast<const int8_t*>(data), static_cast<std::uint32_t>(strlen(data)));
 	}
 
 	std::uint32_t DefaultHashFunctor<const std::string>::operator()(const std::string& data) const
 	{
-		return HashFunctions::SuperFastHash(reinterpret_cast<const int8_t*>(data.c_str()), static_cast<std::uint32_t>(data.size()));
+		return HashFunctions::FastHash(reinterpret_cast<const int8_t*>(data.c_str()), static_cast<std::uint32_t>(data.size()));
+	}
+
+	std::uint32_t DefaultHashFunctor<const std::string>::operator()(const char* data) const
+	{
+		return DefaultHashFunctor<const char*>()(data);
 	}
 }
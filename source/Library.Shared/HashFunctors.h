@@ -2,9 +2,12 @@
 
 #include <cstdint>
 #include <string>
+#include <type_traits>
 
 namespace AnonymousEngine
 {
+	class HashedName;
+
 	/** This class contains hash functions that can be used to define HashFunctors
 	 */
 	class HashFunctions
@@ -16,9 +19,82 @@ namespace AnonymousEngine
 		 *  @return The hash value for the given data
 		 */
 		static std::uint32_t SuperFastHash(const std::int8_t* data, std::uint32_t length);
+
+		/** Calculate hash given an array of bytes and length of the array. Keys up to 32 bytes are read in a few
+		 *  overlapping 64 bit words and mixed with 128 bit multiplies, and longer keys are accumulated 32 bytes at a time
+		 *  in four independent lanes, using SSE2 where it is available. Much faster than SuperFastHash on anything but
+		 *  the shortest keys, with better distribution. An empty array hashes to zero
+		 *  @param data The byte array pointer
+		 *  @param length The length of the byte array
+		 *  @return The hash value for the given data
+		 */
+		static std::uint32_t FastHash(const std::int8_t* data, std::uint32_t length);
+
+		/** Calculate hash of an integer. Every bit of the value affects every bit of the hash, so keys which only differ
+		 *  in their high bits, such as pointers to aligned objects, still spread over the buckets
+		 *  @param value The integer to hash
+		 *  @return The hash value for the given integer
+		 */
+		static std::uint32_t MixInteger(std::uint64_t value);
+
+		/** Calculate FastHash of a string at compile time, such as the hash of a literal key. The result equals FastHash
+		 *  of the same characters, and so the hash DefaultHashFunctor<const std::string> gives the equal string
+		 *  @param text The characters
+		 *  @param length The number of characters
+		 *  @return The hash value for the given characters
+		 */
+		static constexpr std::uint32_t ConstantHash(const char* text, std::uint32_t length);
+
+		/** The odd constants with evenly spread bits, from wyhash, which FastHash mixes keys with
+		 */
+		static constexpr std::uint64_t FastHashSecret[4] = { 0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL };
+		/** The size of the blocks FastHash accumulates long keys in
+		 */
+		static constexpr std::uint32_t FastHashStripeSize = 32U;
+		/** The number of blocks after which FastHash scrambles its accumulators, so their high bits flow back into the
+		 *  multiplies
+		 */
+		static constexpr std::uint32_t FastHashStripesPerScramble = 8U;
+		/** The odd 32 bit multiplier of the scramble step of FastHash
+		 */
+		static constexpr std::uint64_t FastHashScramblePrime = 0x9e3779b1ULL;
+
+	private:
+		// The four accumulators of a long key in ConstantHash
+		struct ConstantLanes
+		{
+			std::uint64_t mLane0;
+			std::uint64_t mLane1;
+			std::uint64_t mLane2;
+			std::uint64_t mLane3;
+
+			constexpr ConstantLanes(std::uint64_t lane0, std::uint64_t lane1, std::uint64_t lane2, std::uint64_t lane3) :
+				mLane0(lane0), mLane1(lane1), mLane2(lane2), mLane3(lane3)
+			{
+			}
+		};
+
+		// ConstantHash is built from single return statements, the only constexpr functions the toolset accepts
+		static constexpr std::uint64_t ConstantByte(const char* text, std::uint32_t index);
+		static constexpr std::uint64_t ConstantRead32(const char* text, std::uint32_t index);
+		static constexpr std::uint64_t ConstantRead64(const char* text, std::uint32_t index);
+		static constexpr std::uint64_t ConstantMultiply(std::uint64_t lhs, std::uint64_t rhs);
+		static constexpr std::uint64_t ConstantCombine(std::uint64_t lowLow, std::uint64_t highLow, std::uint64_t highHigh, std::uint64_t cross);
+		static constexpr std::uint32_t ConstantFinalize(std::uint64_t hash);
+		static constexpr std::uint64_t ConstantShort(const char* text, std::uint32_t length, std::uint32_t middle);
+		static constexpr std::uint64_t ConstantMedium(const char* text, std::uint32_t length);
+		static constexpr std::uint64_t ConstantProduct(std::uint64_t key);
+		static constexpr ConstantLanes ConstantStripe(const ConstantLanes& lanes, const char* text, std::uint32_t offset);
+		static constexpr std::uint64_t ConstantScramble(std::uint64_t lane);
+		static constexpr ConstantLanes ConstantScrambleAfter(const ConstantLanes& lanes, std::uint32_t stripe);
+		static constexpr ConstantLanes ConstantStripes(const ConstantLanes& lanes, const char* text, std::uint32_t length, std::uint32_t stripe);
+		static constexpr std::uint64_t ConstantMerge(const ConstantLanes& lanes);
+		static constexpr std::uint64_t ConstantLong(const char* text, std::uint32_t length);
 	};
 
-	/** The template class for DefaultHashFunctor
+	/** The template class for DefaultHashFunctor. Integers, enums and pointers are hashed with MixInteger and every
+	 *  other type by the bytes of its object representation, so types with padding or with members pointing to their
+	 *  real data need their own specialization
 	 */
 	template <typename T>
 	class DefaultHashFunctor
@@ -29,6 +105,22 @@ namespace AnonymousEngine
 		 *  @return The calculated hash value
 		 */
 		std::uint32_t operator()(const T& data) const;
+
+	private:
+		// Whether the type is hashed as an integer
+		typedef std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> IsInteger;
+
+		// Hash integers, enums and pointers by value
+		static std::uint32_t Hash(const T& data, std::true_type);
+		// Hash everything else by its bytes
+		static std::uint32_t Hash(const T& data, std::false_type);
+
+		// Get the value of a pointer as an integer
+		template <typename TPointee>
+		static std::uint64_t IntegerValue(TPointee* data);
+		// Get the value of an integer or enum as an integer
+		template <typename TValue>
+		static std::uint64_t IntegerValue(const TValue& data);
 	};
 
 	/** The template specialization of DefaultHashFunctor for const char*
@@ -55,6 +147,16 @@ namespace AnonymousEngine
 		*  @return The calculated hash value
 		*/
 		std::uint32_t operator()(const std::string& data) const;
+		/** This function returns the hash value for a C string, which is the same as the hash of the equal std::string
+		*  @param data The data for which hash has to be calculated
+		*  @return The calculated hash value
+		*/
+		std::uint32_t operator()(const char* data) const;
+		/** This function returns the hash a HashedName carries, without hashing again
+		*  @param name The name whose hash is wanted
+		*  @return The hash of the name
+		*/
+		std::uint32_t operator()(const HashedName& name) const;
 	};
 }
 
@@ -1,9 +1,140 @@
-
 namespace AnonymousEngine
 {
+	inline std::uint32_t HashFunctions::MixInteger(std::uint64_t value)
+	{
+		// the finalizer of MurmurHash3, folded to 32 bits
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdULL;
+		value ^= value >> 33;
+		value *= 0xc4ceb9fe1a85ec53ULL;
+		value ^= value >> 33;
+		return static_cast<std::uint32_t>(value);
+	}
+
+	constexpr std::uint32_t HashFunctions::ConstantHash(const char* text, std::uint32_t length)
+	{
+		return (length == 0) ? 0U : ConstantFinalize(((length <= 16) ? ConstantShort(text, length, (length >> 3) << 2) :
+			(length <= FastHashStripeSize) ? ConstantMedium(text, length) : ConstantLong(text, length)) ^ (length * FastHashSecret[3]));
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantByte(const char* text, std::uint32_t index)
+	{
+		return static_cast<std::uint8_t>(text[index]);
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantRead32(const char* text, std::uint32_t index)
+	{
+		return ConstantByte(text, index) | (ConstantByte(text, index + 1) << 8) | (ConstantByte(text, index + 2) << 16) | (ConstantByte(text, index + 3) << 24);
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantRead64(const char* text, std::uint32_t index)
+	{
+		return ConstantRead32(text, index) | (ConstantRead32(text, index + 4) << 32);
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantMultiply(std::uint64_t lhs, std::uint64_t rhs)
+	{
+		return ConstantCombine((lhs & 0xffffffffULL) * (rhs & 0xffffffffULL), (lhs >> 32) * (rhs & 0xffffffffULL), (lhs >> 32) * (rhs >> 32),
+			(((lhs & 0xffffffffULL) * (rhs & 0xffffffffULL)) >> 32) + (((lhs >> 32) * (rhs & 0xffffffffULL)) & 0xffffffffULL) + (lhs & 0xffffffffULL) * (rhs >> 32));
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantCombine(std::uint64_t lowLow, std::uint64_t highLow, std::uint64_t highHigh, std::uint64_t cross)
+	{
+		return ((cross << 32) | (lowLow & 0xffffffffULL)) ^ ((highLow >> 32) + (cross >> 32) + highHigh);
+	}
+
+	constexpr std::uint32_t HashFunctions::ConstantFinalize(std::uint64_t hash)
+	{
+		return static_cast<std::uint32_t>(ConstantMultiply(hash ^ FastHashSecret[0], FastHashSecret[1]) ^ (ConstantMultiply(hash ^ FastHashSecret[0], FastHashSecret[1]) >> 32));
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantShort(const char* text, std::uint32_t length, std::uint32_t middle)
+	{
+		return (length >= 4) ?
+			ConstantMultiply(((ConstantRead32(text, 0) << 32) | ConstantRead32(text, middle)) ^ FastHashSecret[1],
+				((ConstantRead32(text, length - 4) << 32) | ConstantRead32(text, length - 4 - middle)) ^ FastHashSecret[0]) :
+			ConstantMultiply(((ConstantByte(text, 0) << 16) | (ConstantByte(text, length >> 1) << 8) | ConstantByte(text, length - 1)) ^ FastHashSecret[1], FastHashSecret[0]);
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantMedium(const char* text, std::uint32_t length)
+	{
+		return ConstantMultiply(ConstantRead64(text, 0) ^ FastHashSecret[1], ConstantRead64(text, 8) ^ FastHashSecret[2]) ^
+			ConstantMultiply(ConstantRead64(text, length - 16) ^ FastHashSecret[3], ConstantRead64(text, length - 8) ^ FastHashSecret[0]);
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantProduct(std::uint64_t key)
+	{
+		return (key & 0xffffffffULL) * (key >> 32);
+	}
+
+	constexpr HashFunctions::ConstantLanes HashFunctions::ConstantStripe(const ConstantLanes& lanes, const char* text, std::uint32_t offset)
+	{
+		return ConstantLanes(
+			lanes.mLane0 + ConstantProduct(ConstantRead64(text, offset) ^ FastHashSecret[0]) + ConstantRead64(text, offset + 8),
+			lanes.mLane1 + ConstantProduct(ConstantRead64(text, offset + 8) ^ FastHashSecret[1]) + ConstantRead64(text, offset),
+			lanes.mLane2 + ConstantProduct(ConstantRead64(text, offset + 16) ^ FastHashSecret[2]) + ConstantRead64(text, offset + 24),
+			lanes.mLane3 + ConstantProduct(ConstantRead64(text, offset + 24) ^ FastHashSecret[3]) + ConstantRead64(text, offset + 16));
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantScramble(std::uint64_t lane)
+	{
+		return (lane ^ (lane >> 47)) * FastHashScramblePrime;
+	}
+
+	constexpr HashFunctions::ConstantLanes HashFunctions::ConstantScrambleAfter(const ConstantLanes& lanes, std::uint32_t stripe)
+	{
+		return (stripe % FastHashStripesPerScramble == FastHashStripesPerScramble - 1) ?
+			ConstantLanes(ConstantScramble(lanes.mLane0), ConstantScramble(lanes.mLane1), ConstantScramble(lanes.mLane2), ConstantScramble(lanes.mLane3)) :
+			lanes;
+	}
+
+	constexpr HashFunctions::ConstantLanes HashFunctions::ConstantStripes(const ConstantLanes& lanes, const char* text, std::uint32_t length, std::uint32_t stripe)
+	{
+		return (stripe == (length - 1) / FastHashStripeSize) ?
+			ConstantStripe(lanes, text, length - FastHashStripeSize) :
+			ConstantStripes(ConstantScrambleAfter(ConstantStripe(lanes, text, stripe * FastHashStripeSize), stripe), text, length, stripe + 1);
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantMerge(const ConstantLanes& lanes)
+	{
+		return ConstantMultiply(lanes.mLane0 ^ FastHashSecret[2], lanes.mLane1 ^ FastHashSecret[3]) +
+			ConstantMultiply(lanes.mLane2 ^ FastHashSecret[0], lanes.mLane3 ^ FastHashSecret[1]);
+	}
+
+	constexpr std::uint64_t HashFunctions::ConstantLong(const char* text, std::uint32_t length)
+	{
+		return ConstantMerge(ConstantStripes(ConstantLanes(FastHashSecret[0], FastHashSecret[1], FastHashSecret[2], FastHashSecret[3]), text, length, 0));
+	}
+
 	template <typename T>
 	std::uint32_t DefaultHashFunctor<T>::operator()(const T& data) const
 	{
-		return HashFunctions::SuperFastHash(reinterpret_cast<const std::int8_t*>(&data), sizeof(T));
+		return Hash(data, IsInteger());
+	}
+
+	template <typename T>
+	std::uint32_t DefaultHashFunctor<T>::Hash(const T& data, std::true_type)
+	{
+		return HashFunctions::MixInteger(IntegerValue(data));
+	}
+
+	template <typename T>
+	std::uint32_t DefaultHashFunctor<T>::Hash(const T& data, std::false_type)
+	{
+		return HashFunctions::FastHash(reinterpret_cast<const std::int8_t*>(&data), sizeof(T));
+	}
+
+	template <typename T>
+	template <typename TPointee>
+	std::uint64_t DefaultHashFunctor<T>::IntegerValue(TPointee* data)
+	{
+		return reinterpret_cast<std::uintptr_t>(data);
+	}
+
+	template <typename T>
+	template <typename TValue>
+	std::uint64_t DefaultHashFunctor<T>::IntegerValue(const TValue& data)
+	{
+		return static_cast<std::uint64_t>(data);
 	}
 }
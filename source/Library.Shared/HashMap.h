@@ -5,6 +5,7 @@
 #include <utility>
 #include "Compare.h"
 #include "HashFunctors.h"
+#include "NodePool.h"
 #include "SList.h"
 #include "Vector.h"
 
@@ -19,9 +20,22 @@ namespace AnonymousEngine
 		/** The type of each entry in the hashmap
 		*/
 		typedef std::pair<const TKey, TData> EntryType;
-		/** The type of each chain in the hashmap bucket
+		/** An entry stored in a chain, along with the full hash of its key. Searches compare the hashes before the keys,
+		 *  so a chain with several entries only compares the keys which are likely to match
 		*/
-		typedef SList<EntryType> ChainType;
+		struct ChainEntry
+		{
+			// The full hash of the key
+			std::uint32_t mHash;
+			// The entry
+			EntryType mEntry;
+
+			// Construct a chain entry from the hash of its key and the entry
+			ChainEntry(std::uint32_t hash, const EntryType& entry);
+		};
+		/** The type of each chain in the hashmap bucket. All the chains take their nodes from one pool owned by the hashmap
+		*/
+		typedef SList<ChainEntry, SharedNodeAllocator> ChainType;
 		/** The type of the hashmap buckets
 		*/
 		typedef Vector<ChainType> BucketType;
@@ -118,15 +132,15 @@ namespace AnonymousEngine
 		 */
 		HashMap(const std::initializer_list<EntryType>& entries);
 
-		/** Copy constructor. Defaults will suffice here
+		/** Copy constructor. The copy has the same buckets, with its nodes in its own pool
 		 *  @param rhs The hashmap to copy from
 		 */
-		HashMap(const HashMap& rhs) = default;
-		/** Copy Assignment operator. Defaults will suffice here
+		HashMap(const HashMap& rhs);
+		/** Copy Assignment operator
 		 *  @param rhs The hashmap to assign from
 		 *  @return A reference to the current hashmap
 		*/
-		HashMap& operator=(const HashMap& rhs) = default;
+		HashMap& operator=(const HashMap& rhs);
 
 		/** Move constructor. Defaults will suffice here
 		 *  @param rhs The hashmap to copy from
@@ -143,6 +157,21 @@ namespace AnonymousEngine
 		 *  @return Iterator to the found key. Returns end() if the key is not found.
 		 */
 		Iterator Find(const TKey& key) const;
+		/** Searches for a key in the hashmap using another type which can stand in for the key, such as a C string for
+		 *  std::string keys, without constructing a key. THashFunctor has to hash it the same as the equal key and
+		 *  TCompareFunctor has to compare a key with it
+		 *  @param key The value to search for in the hashmap
+		 *  @return Iterator to the found key. Returns end() if the key is not found.
+		 */
+		template <typename TLookupKey>
+		Iterator Find(const TLookupKey& key) const;
+		/** Searches for a key whose hash is already known, such as a key hashed at compile time
+		 *  @param key The value to search for in the hashmap
+		 *  @param hash The hash THashFunctor gives for the key
+		 *  @return Iterator to the found key. Returns end() if the key is not found.
+		 */
+		template <typename TLookupKey>
+		Iterator Find(const TLookupKey& key, std::uint32_t hash) const;
 
 		/** Insert an entry into the hashmap. This method would not overwrite any existing element with the same key
 		 *  @param entry The entry to insert into the hashmap
@@ -157,7 +186,7 @@ namespace AnonymousEngine
 		 */
 		Iterator Insert(const EntryType& entry, bool& hasInserted);
 
-		/** Insert an entry into the hashmap.
+		/** Remove an entry from the hashmap. Removing the last entry frees the memory held for the nodes
 		 *  @param key The key of the element which should be removed from the hashmap
 		 *  @return A boolean indicating whether the element was removed or not
 		 */
@@ -201,6 +230,19 @@ namespace AnonymousEngine
 		 *  @return A boolean indicating whether the key is present in the hashmap or not
 		 */
 		bool ContainsKey(const TKey& key) const;
+		/** Checks if a key is present in the hashmap using another type which can stand in for the key
+		 *  @param key The value to search in the hashmap
+		 *  @return A boolean indicating whether the key is present in the hashmap or not
+		 */
+		template <typename TLookupKey>
+		bool ContainsKey(const TLookupKey& key) const;
+		/** Checks if a key whose hash is already known is present in the hashmap
+		 *  @param key The value to search in the hashmap
+		 *  @param hash The hash THashFunctor gives for the key
+		 *  @return A boolean indicating whether the key is present in the hashmap or not
+		 */
+		template <typename TLookupKey>
+		bool ContainsKey(const TLookupKey& key, std::uint32_t hash) const;
 
 		/** Return an iterator to the beginning of the hashmap
 		 *  @return An iterator to the beginning of the hashmap
@@ -211,15 +253,21 @@ namespace AnonymousEngine
 		 */
 		Iterator end() const;
 
-		/** Finalizes the hashmap. Default implementation suffices here.
+		/** Finalizes the hashmap, freeing the pool of its nodes
 		 */
-		~HashMap() = default;
+		~HashMap();
 	private:
 		BucketType mData;
 		std::uint32_t mSize;
+		// The pool the nodes of every chain come from. It is held by value, so a hashmap costs no allocation until its
+		// first entry, and the chains are pointed at it again whenever the hashmap moves
+		NodePool mPool;
 
-		Iterator InsertEntry(const TKey& key, const TData& data);
-		std::uint32_t CalculateIndex(const TKey& key) const;
+		// Insert an entry which is known not to be in the hashmap
+		Iterator InsertEntry(const TKey& key, const TData& data, std::uint32_t hash);
+		// Calculate the full hash of a key
+		template <typename TLookupKey>
+		static std::uint32_t Hash(const TLookupKey& key);
 
 		// internal method for move semantics
 		void Move(HashMap& rhs);
@@ -60,13 +60,13 @@ namespace AnonymousEngine
 		{
 			throw std::out_of_range("iterator out of range");
 		}
-		return *mChainIterator;
+		return (*mChainIterator).mEntry;
 	}
 
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
 	const typename HashMap<TKey, TData, THashFunctor, TCompareFunctor>::EntryType& HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator::operator*() const
 	{
-		return const_cast<const EntryType&>(const_cast<const typename HashMap::Iterator*>(this)->operator*());
+		return const_cast<const EntryType&>(const_cast<typename HashMap::Iterator*>(this)->operator*());
 	}
 
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
@@ -107,19 +107,25 @@ namespace AnonymousEngine
 #pragma endregion
 
 #pragma region HashMapMethods
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	HashMap<TKey, TData, THashFunctor, TCompareFunctor>::ChainEntry::ChainEntry(std::uint32_t hash, const EntryType& entry) :
+		mHash(hash), mEntry(entry)
+	{
+	}
+
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
 	HashMap<TKey, TData, THashFunctor, TCompareFunctor>::HashMap(std::uint32_t buckets) :
-		mData(BucketType(buckets)), mSize(0U)
+		mData(BucketType(buckets)), mSize(0U), mPool()
 	{
 		if (buckets == 0)
 		{
 			throw std::invalid_argument("Buckets can't be zero");
 		}
 
-		// push default constructed lists into all slots in the vector
+		// push empty lists sharing the pool into all slots in the vector
 		for (std::uint32_t i = 0; i < buckets; ++i)
 		{
-			mData.PushBack(ChainType());
+			mData.PushBack(ChainType(SharedNodeAllocator(&mPool)));
 		}
 	}
 
@@ -134,7 +140,34 @@ namespace AnonymousEngine
 	}
 
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
-	HashMap<TKey, TData, THashFunctor, TCompareFunctor>::HashMap(HashMap&& rhs) noexcept
+	HashMap<TKey, TData, THashFunctor, TCompareFunctor>::HashMap(const HashMap& rhs) :
+		HashMap(rhs.mData.Size())
+	{
+		// the buckets match, so every entry goes to the same chain at the same position
+		for (std::uint32_t index = 0; index < rhs.mData.Size(); ++index)
+		{
+			for (const auto& entry : rhs.mData[index])
+			{
+				mData[index].PushBack(entry);
+			}
+		}
+		mSize = rhs.mSize;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	HashMap<TKey, TData, THashFunctor, TCompareFunctor>& HashMap<TKey, TData, THashFunctor, TCompareFunctor>::operator=(const HashMap& rhs)
+	{
+		if (this != &rhs)
+		{
+			HashMap copy(rhs);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	HashMap<TKey, TData, THashFunctor, TCompareFunctor>::HashMap(HashMap&& rhs) noexcept :
+		mSize(0U), mPool()
 	{
 		Move(rhs);
 	}
@@ -153,17 +186,14 @@ namespace AnonymousEngine
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
 	typename HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Find(const TKey& key) const
 	{
-		std::uint32_t index = CalculateIndex(key);
-		static DefaultCompare<const TKey> compare;
-		const ChainType& chain = mData[index];
-		for (auto it = chain.begin(); it != chain.end(); ++it)
-		{
-			if (compare((*it).first, key))
-			{
-				return Iterator(index, it, const_cast<HashMap*>(this));
-			}
-		}
-		return end();
+		return Find(key, Hash(key));
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TLookupKey>
+	typename HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Find(const TLookupKey& key) const
+	{
+		return Find(key, Hash(key));
 	}
 
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
@@ -176,11 +206,12 @@ namespace AnonymousEngine
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
 	typename HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Insert(const EntryType& entry, bool& hasInserted)
 	{
-		Iterator it = Find(entry.first);
+		std::uint32_t hash = Hash(entry.first);
+		Iterator it = Find(entry.first, hash);
 		hasInserted = false;
 		if (it == end())
 		{
-			it = InsertEntry(entry.first, entry.second);
+			it = InsertEntry(entry.first, entry.second, hash);
 			hasInserted = true;
 		}
 		return it;
@@ -192,8 +223,13 @@ namespace AnonymousEngine
 		Iterator it = Find(key);
 		if (it != end())
 		{
-			mData[it.mIndex].Remove(*it);
+			mData[it.mIndex].Remove(it.mChainIterator);
 			--mSize;
+			// give the slabs back once the last entry is gone, so long lived maps don't hold on to the nodes they grew
+			if (mSize == 0)
+			{
+				mPool.Release();
+			}
 			return true;
 		}
 		return false;
@@ -202,10 +238,11 @@ namespace AnonymousEngine
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
 	TData& HashMap<TKey, TData, THashFunctor, TCompareFunctor>::operator[](const TKey& key)
 	{
-		Iterator it = Find(key);
+		std::uint32_t hash = Hash(key);
+		Iterator it = Find(key, hash);
 		if (it == end())
 		{
-			it = InsertEntry(key, TData());
+			it = InsertEntry(key, TData(), hash);
 		}
 		return it->second;
 	}
@@ -262,6 +299,20 @@ namespace AnonymousEngine
 		return (Find(key) != end());
 	}
 
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TLookupKey>
+	bool HashMap<TKey, TData, THashFunctor, TCompareFunctor>::ContainsKey(const TLookupKey& key) const
+	{
+		return (Find(key) != end());
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	template <typename TLookupKey>
+	bool HashMap<TKey, TData, THashFunctor, TCompareFunctor>::ContainsKey(const TLookupKey& key, std::uint32_t hash) const
+	{
+		return (Find(key, hash) != end());
+	}
+
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
 	void HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Clear()
 	{
@@ -269,6 +320,7 @@ namespace AnonymousEngine
 		{
 			chainObject.Clear();
 		}
+		mPool.Release();
 		mSize = 0;
 	}
 
@@ -294,19 +346,38 @@ namespace AnonymousEngine
 	}
 
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
-	typename HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TCompareFunctor>::InsertEntry(const TKey& key, const TData& data)
+	template <typename TLookupKey>
+	typename HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Find(const TLookupKey& key, std::uint32_t hash) const
+	{
+		static TCompareFunctor compare;
+		std::uint32_t index = hash % mData.Size();
+		const ChainType& chain = mData[index];
+		for (auto it = chain.begin(); it != chain.end(); ++it)
+		{
+			const ChainEntry& chainEntry = *it;
+			if (chainEntry.mHash == hash && compare(chainEntry.mEntry.first, key))
+			{
+				return Iterator(index, it, const_cast<HashMap*>(this));
+			}
+		}
+		return end();
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	typename HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TCompareFunctor>::InsertEntry(const TKey& key, const TData& data, std::uint32_t hash)
 	{
-		std::uint32_t index = CalculateIndex(key);
-		ChainIterator it = mData[index].PushBack(std::make_pair(key, data));
+		std::uint32_t index = hash % mData.Size();
+		ChainIterator it = mData[index].PushBack(ChainEntry(hash, std::make_pair(key, data)));
 		++mSize;
 		return Iterator(index, it, this);
 	}
 
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
-	std::uint32_t HashMap<TKey, TData, THashFunctor, TCompareFunctor>::CalculateIndex(const TKey& key) const
+	template <typename TLookupKey>
+	std::uint32_t HashMap<TKey, TData, THashFunctor, TCompareFunctor>::Hash(const TLookupKey& key)
 	{
 		static THashFunctor hashFunctor;
-		return (hashFunctor(key) % mData.Size());
+		return hashFunctor(key);
 	}
 
 	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
@@ -314,7 +385,21 @@ namespace AnonymousEngine
 	{
 		mData = std::move(rhs.mData);
 		mSize = rhs.mSize;
+		mPool = std::move(rhs.mPool);
 		rhs.mSize = 0;
+
+		// the nodes came along with the slabs, but the chains still point at the pool of the other hashmap
+		for (auto& chain : mData)
+		{
+			chain.Allocator() = SharedNodeAllocator(&mPool);
+		}
+	}
+
+	template <typename TKey, typename TData, typename THashFunctor, typename TCompareFunctor>
+	HashMap<TKey, TData, THashFunctor, TCompareFunctor>::~HashMap()
+	{
+		// the chains go back to the pool before it is freed
+		mData.Clear();
 	}
 
 #pragma endregion
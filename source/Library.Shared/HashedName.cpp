@@ -0,0 +1,14 @@
+#include "HashedName.h"
+
+namespace AnonymousEngine
+{
+	HashedName::HashedName(const std::string& name) :
+		mName(name.c_str()), mLength(static_cast<std::uint32_t>(name.size())), mHash(DefaultHashFunctor<const std::string>()(name))
+	{
+	}
+
+	std::string HashedName::ToString() const
+	{
+		return std::string(mName, mLength);
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "Compare.h"
+#include "HashFunctors.h"
+
+namespace AnonymousEngine
+{
+	/** A name along with its hash. Hashmaps with std::string keys, and scopes, can be searched with it without hashing
+	 *  the name again. A name made from a literal is hashed at compile time, so a constant such as
+	 *  static constexpr HashedName ActionsName("Actions") costs nothing at runtime. A hashed name only views its
+	 *  characters, which have to outlive it
+	 */
+	class HashedName final
+	{
+	public:
+		/** Initialize a hashed name from a literal, hashing it at compile time
+		 *  @param name The literal
+		 */
+		template <std::size_t Size>
+		explicit constexpr HashedName(const char (&name)[Size]) :
+			mName(name), mLength(static_cast<std::uint32_t>(Size - 1)), mHash(HashFunctions::ConstantHash(name, static_cast<std::uint32_t>(Size - 1)))
+		{
+		}
+
+		/** Initialize a hashed name from a string, hashing it now
+		 *  @param name The string, which has to outlive the hashed name
+		 */
+		explicit HashedName(const std::string& name);
+
+		/** Get the characters of the name, which aren't necessarily null terminated
+		 *  @return The first character of the name
+		 */
+		constexpr const char* Name() const
+		{
+			return mName;
+		}
+
+		/** Get the length of the name
+		 *  @return The number of characters in the name
+		 */
+		constexpr std::uint32_t Length() const
+		{
+			return mLength;
+		}
+
+		/** Get the hash of the name, which is what DefaultHashFunctor<const std::string> gives for the equal string
+		 *  @return The hash of the name
+		 */
+		constexpr std::uint32_t Hash() const
+		{
+			return mHash;
+		}
+
+		/** Copy the name into a string
+		 *  @return The name
+		 */
+		std::string ToString() const;
+
+	private:
+		const char* mName;
+		std::uint32_t mLength;
+		std::uint32_t mHash;
+	};
+
+	inline std::uint32_t DefaultHashFunctor<const std::string>::operator()(const HashedName& name) const
+	{
+		return name.Hash();
+	}
+
+	inline bool DefaultCompare<const std::string>::operator()(const std::string& lhs, const HashedName& rhs) const
+	{
+		return (lhs.size() == rhs.Length()) && (lhs.compare(0, lhs.size(), rhs.Name(), rhs.Length()) == 0);
+	}
+}
@@ -0,0 +1,103 @@
+#include "HeadlessSimulation.h"
+#include "EventQueue.h"
+#include "World.h"
+#include "WorldParserHelper.h"
+#include "WorldSharedData.h"
+#include "XmlParseMaster.h"
+
+namespace AnonymousEngine
+{
+	namespace Containers
+	{
+		using namespace std::chrono;
+
+		HeadlessSimulation::HeadlessSimulation(World& world, Core::EventQueue& eventQueue, const milliseconds& step) :
+			mWorld(world), mEventQueue(eventQueue), mStep(step), mClock(), mWorldState(), mTicks(0), mMeasuredTicks(0),
+			mWallTime(0)
+		{
+			if (step.count() <= 0)
+			{
+				throw std::invalid_argument("Simulation step should be positive.");
+			}
+			mWorldState.mGameTime.SetCurrentTime(mClock.StartTime());
+		}
+
+		void HeadlessSimulation::Tick()
+		{
+			mClock.StepGameTime(mWorldState.mGameTime, mStep);
+			mWorld.Update(mWorldState);
+			mEventQueue.Update(mWorldState.mGameTime);
+			++mTicks;
+		}
+
+		void HeadlessSimulation::Run(std::uint64_t ticks)
+		{
+			high_resolution_clock::time_point start = high_resolution_clock::now();
+			for (std::uint64_t index = 0; index < ticks; ++index)
+			{
+				Tick();
+			}
+			mWallTime += (high_resolution_clock::now() - start);
+			mMeasuredTicks += ticks;
+		}
+
+		void HeadlessSimulation::RunFor(const milliseconds& gameTime)
+		{
+			std::uint64_t ticks = static_cast<std::uint64_t>((gameTime.count() + mStep.count() - 1) / mStep.count());
+			Run(ticks);
+		}
+
+		void HeadlessSimulation::Reset()
+		{
+			mClock.Reset();
+			mWorldState.mGameTime.SetTotalGameTime(milliseconds(0));
+			mWorldState.mGameTime.SetElapsedGameTime(milliseconds(0));
+			mWorldState.mGameTime.SetCurrentTime(mClock.StartTime());
+			mTicks = 0;
+			mMeasuredTicks = 0;
+			mWallTime = high_resolution_clock::duration(0);
+		}
+
+		std::uint64_t HeadlessSimulation::Ticks() const
+		{
+			return mTicks;
+		}
+
+		const milliseconds& HeadlessSimulation::Step() const
+		{
+			return mStep;
+		}
+
+		const milliseconds& HeadlessSimulation::SimulatedTime() const
+		{
+			return mWorldState.mGameTime.TotalGameTime();
+		}
+
+		high_resolution_clock::duration HeadlessSimulation::WallTime() const
+		{
+			return mWallTime;
+		}
+
+		double HeadlessSimulation::TicksPerSecond() const
+		{
+			double seconds = duration_cast<duration<double>>(mWallTime).count();
+			return (seconds > 0.0) ? (mMeasuredTicks / seconds) : 0.0;
+		}
+
+		WorldState& HeadlessSimulation::State()
+		{
+			return mWorldState;
+		}
+
+		World* HeadlessSimulation::LoadWorld(const std::string& filename)
+		{
+			Parsers::WorldSharedData data;
+			Parsers::XmlParseMaster parser(data);
+			Parsers::WorldParserHelper helper;
+			parser.AddHelper(helper);
+			parser.ParseFromFile(filename);
+
+			return data.ExtractWorld();
+		}
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "GameClock.h"
+#include "WorldState.h"
+
+namespace AnonymousEngine
+{
+	namespace Core
+	{
+		class EventQueue;
+	}
+
+	namespace Containers
+	{
+		class World;
+
+		/** Runs a world as a pure simulation without any window or renderer. Game time advances by a fixed step on
+		 *  every tick, independent of the wall clock, so the world is updated as fast as the CPU allows and two runs
+		 *  with the same number of ticks observe exactly the same game time
+		 */
+		class HeadlessSimulation final
+		{
+		public:
+			/** Initialize a simulation over a world and an event queue
+			 *  @param world The world to update on every tick
+			 *  @param eventQueue The event queue to update on every tick, on the same virtual clock as the world
+			 *  @param step The amount of game time that passes on every tick
+			 *  @exception std::invalid_argument Thrown if the step is not positive
+			 */
+			HeadlessSimulation(World& world, Core::EventQueue& eventQueue, const std::chrono::milliseconds& step = std::chrono::milliseconds(16));
+			/** Free up any resources allocated by the instance
+			 */
+			~HeadlessSimulation() = default;
+
+			// Delete move and copy semantics
+			HeadlessSimulation(const HeadlessSimulation&) = delete;
+			HeadlessSimulation& operator=(const HeadlessSimulation&) = delete;
+
+			/** Advance the game time by one step, update the world and then the event queue
+			 */
+			void Tick();
+			/** Tick the simulation a given number of times, measuring the wall clock time it takes
+			 *  @param ticks The number of ticks to run
+			 */
+			void Run(std::uint64_t ticks);
+			/** Tick the simulation until at least the given amount of game time has passed since the current game time
+			 *  @param gameTime The amount of game time to simulate
+			 */
+			void RunFor(const std::chrono::milliseconds& gameTime);
+
+			/** Bring the game time, tick count and measured wall clock time back to zero. The world is not reloaded
+			 */
+			void Reset();
+
+			/** The number of ticks run so far
+			 *  @return The tick count
+			 */
+			std::uint64_t Ticks() const;
+			/** The fixed amount of game time that passes on every tick
+			 *  @return The step of the simulation
+			 */
+			const std::chrono::milliseconds& Step() const;
+			/** The total game time simulated so far
+			 *  @return The simulated game time
+			 */
+			const std::chrono::milliseconds& SimulatedTime() const;
+			/** The wall clock time spent inside Run and RunFor
+			 *  @return The measured wall clock time
+			 */
+			std::chrono::high_resolution_clock::duration WallTime() const;
+			/** The rate at which ticks were run inside Run and RunFor
+			 *  @return The number of ticks per wall clock second. Zero if nothing was measured yet
+			 */
+			double TicksPerSecond() const;
+
+			/** The world state that is passed to the world on every tick
+			 *  @return The world state of the simulation
+			 */
+			WorldState& State();
+
+			/** Parse a world xml file. Factories for every entity and action type used in the file should already be
+			 *  registered. The returned world should be explicitly deleted by the user
+			 *  @param filename The path of the world xml file
+			 *  @return The parsed world
+			 */
+			static World* LoadWorld(const std::string& filename);
+		private:
+			// The world being simulated
+			World& mWorld;
+			// The event queue updated along with the world
+			Core::EventQueue& mEventQueue;
+			// Game time added on every tick
+			std::chrono::milliseconds mStep;
+			// Used to step the game time without reading the wall clock
+			GameClock mClock;
+			// The world state passed to every update
+			WorldState mWorldState;
+			// The number of ticks run so far
+			std::uint64_t mTicks;
+			// The number of ticks run inside Run and RunFor
+			std::uint64_t mMeasuredTicks;
+			// The wall clock time spent inside Run and RunFor
+			std::chrono::high_resolution_clock::duration mWallTime;
+		};
+	}
+}
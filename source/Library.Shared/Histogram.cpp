@@ -0,0 +1,130 @@
+#include "Histogram.h"
+#include <algorithm>
+#include <cstring>
+
+namespace AnonymousEngine
+{
+	Histogram::Histogram() :
+		mCount(0), mMin(0), mMax(0), mSum(0.0)
+	{
+		Reset();
+	}
+
+	void Histogram::Record(std::uint64_t value)
+	{
+		++mBuckets[BucketIndex(value)];
+		mMin = (mCount == 0) ? value : std::min(mMin, value);
+		mMax = std::max(mMax, value);
+		mSum += static_cast<double>(value);
+		++mCount;
+	}
+
+	void Histogram::Merge(const Histogram& rhs)
+	{
+		if (rhs.mCount == 0)
+		{
+			return;
+		}
+
+		for (std::uint32_t index = 0; index < BucketCount; ++index)
+		{
+			mBuckets[index] += rhs.mBuckets[index];
+		}
+		mMin = (mCount == 0) ? rhs.mMin : std::min(mMin, rhs.mMin);
+		mMax = std::max(mMax, rhs.mMax);
+		mSum += rhs.mSum;
+		mCount += rhs.mCount;
+	}
+
+	void Histogram::Reset()
+	{
+		std::memset(mBuckets, 0, sizeof(mBuckets));
+		mCount = 0;
+		mMin = 0;
+		mMax = 0;
+		mSum = 0.0;
+	}
+
+	std::uint64_t Histogram::Count() const
+	{
+		return mCount;
+	}
+
+	std::uint64_t Histogram::Min() const
+	{
+		return mMin;
+	}
+
+	std::uint64_t Histogram::Max() const
+	{
+		return mMax;
+	}
+
+	double Histogram::Mean() const
+	{
+		return (mCount == 0) ? 0.0 : (mSum / mCount);
+	}
+
+	std::uint64_t Histogram::ValueAtPercentile(double percentile) const
+	{
+		if (mCount == 0)
+		{
+			return 0;
+		}
+
+		percentile = std::min(std::max(percentile, 0.0), 100.0);
+		std::uint64_t target = static_cast<std::uint64_t>((percentile / 100.0) * mCount + 0.5);
+		target = std::max(target, static_cast<std::uint64_t>(1U));
+
+		std::uint64_t runningCount = 0;
+		for (std::uint32_t index = 0; index < BucketCount; ++index)
+		{
+			runningCount += mBuckets[index];
+			if (runningCount >= target)
+			{
+				return std::min(HighestEquivalentValue(index), mMax);
+			}
+		}
+		return mMax;
+	}
+
+	std::uint64_t Histogram::CountAtValue(std::uint64_t value) const
+	{
+		return mBuckets[BucketIndex(value)];
+	}
+
+	std::uint32_t Histogram::BucketIndex(std::uint64_t value)
+	{
+		if (value < SubBucketCount)
+		{
+			return static_cast<std::uint32_t>(value);
+		}
+
+		// position of the highest set bit
+		std::uint32_t magnitude = 0;
+		for (std::uint32_t step = 32; step > 0; step >>= 1)
+		{
+			if ((value >> (magnitude + step)) != 0)
+			{
+				magnitude += step;
+			}
+		}
+
+		std::uint32_t shift = magnitude - (SubBucketBits - 1);
+		std::uint32_t subBucket = static_cast<std::uint32_t>(value >> shift) - SubBucketHalfCount;
+		return SubBucketCount + (magnitude - SubBucketBits) * SubBucketHalfCount + subBucket;
+	}
+
+	std::uint64_t Histogram::HighestEquivalentValue(std::uint32_t index)
+	{
+		if (index < SubBucketCount)
+		{
+			return index;
+		}
+
+		std::uint32_t magnitude = (index - SubBucketCount) / SubBucketHalfCount + SubBucketBits;
+		std::uint64_t subBucket = (index - SubBucketCount) % SubBucketHalfCount + SubBucketHalfCount;
+		std::uint32_t shift = magnitude - (SubBucketBits - 1);
+		return (subBucket << shift) + ((1ULL << shift) - 1);
+	}
+}
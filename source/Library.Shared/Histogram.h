@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+
+namespace AnonymousEngine
+{
+	/** A fixed size, log-linear histogram in the style of HDR histograms.
+	 *  Every power of two range is split into equally sized sub buckets, which keeps the relative error of any recorded
+	 *  value under 1 / SubBucketHalfCount while covering the whole 64 bit range without any allocation
+	 */
+	class Histogram final
+	{
+	public:
+		/** Initialize an empty histogram
+		 */
+		Histogram();
+
+		/** Default copy constructor
+		 */
+		Histogram(const Histogram& rhs) = default;
+		/** Default copy assignment operator
+		 */
+		Histogram& operator=(const Histogram& rhs) = default;
+
+		/** Release any allocated resources
+		 */
+		~Histogram() = default;
+
+		/** Record a value into the histogram
+		 *  @param value The value to record
+		 */
+		void Record(std::uint64_t value);
+
+		/** Add all the values recorded in another histogram into this one
+		 *  @param rhs The histogram to merge in
+		 */
+		void Merge(const Histogram& rhs);
+
+		/** Remove all the recorded values
+		 */
+		void Reset();
+
+		/** The number of values recorded
+		 *  @return The number of values recorded
+		 */
+		std::uint64_t Count() const;
+		/** The smallest value recorded
+		 *  @return The smallest value recorded. Zero if the histogram is empty
+		 */
+		std::uint64_t Min() const;
+		/** The largest value recorded
+		 *  @return The largest value recorded. Zero if the histogram is empty
+		 */
+		std::uint64_t Max() const;
+		/** The arithmetic mean of all the recorded values
+		 *  @return The mean of the recorded values. Zero if the histogram is empty
+		 */
+		double Mean() const;
+
+		/** Get the value below which the given percentage of recorded values fall
+		 *  @param percentile The percentile to query in the range [0, 100]
+		 *  @return The highest value equivalent to the bucket in which the percentile falls, clamped to Max()
+		 */
+		std::uint64_t ValueAtPercentile(double percentile) const;
+
+		/** The number of values recorded in the bucket the given value falls into
+		 *  @param value The value to look up
+		 *  @return The count of the bucket equivalent to the value
+		 */
+		std::uint64_t CountAtValue(std::uint64_t value) const;
+
+	private:
+		// Number of linear sub buckets used for every power of two range
+		static const std::uint32_t SubBucketCount = 16U;
+		static const std::uint32_t SubBucketHalfCount = SubBucketCount / 2;
+		static const std::uint32_t SubBucketBits = 4U;
+		// Number of buckets required to cover the whole 64 bit range
+		static const std::uint32_t BucketCount = SubBucketCount + (64U - SubBucketBits) * SubBucketHalfCount;
+
+		// Maps a value to the index of the bucket it is counted in
+		static std::uint32_t BucketIndex(std::uint64_t value);
+		// The largest value which maps to the bucket at the given index
+		static std::uint64_t HighestEquivalentValue(std::uint32_t index);
+
+		std::uint64_t mBuckets[BucketCount];
+		std::uint64_t mCount;
+		std::uint64_t mMin;
+		std::uint64_t mMax;
+		double mSum;
+	};
+}
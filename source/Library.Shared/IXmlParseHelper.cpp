@@ -10,7 +10,17 @@ namespace AnonymousEngine
 		{
 		}
 
-		void IXmlParserHelper::CharDataHandler(SharedData&, const std::string&)
+		Vector<std::string> IXmlParserHelper::Tags() const
+		{
+			return Vector<std::string>();
+		}
+
+		bool IXmlParserHelper::IsSharedDataSupported(const SharedData&) const
+		{
+			return true;
+		}
+
+		void IXmlParserHelper::CharDataHandler(SharedData&, const XML_Char*, std::uint32_t)
 		{
 			// Default implementation if a helper doesn't want to handle char data
 		}
@@ -1,8 +1,9 @@
 #pragma once
 
 #include <string>
-#include "HashMap.h"
 #include "SharedData.h"
+#include "Vector.h"
+#include "XmlAttributes.h"
 
 namespace AnonymousEngine
 {
@@ -15,12 +16,25 @@ namespace AnonymousEngine
 			 */
 			virtual void Initialize();
 
+			/** The names of the elements this helper owns. The parse master routes those elements straight to this helper
+			 *  instead of offering them to every helper in turn. A helper which owns no tags is offered every element that
+			 *  no other helper owns, in the order the helpers were added
+			 *  @return The lower case names of the elements handled by this helper
+			 */
+			virtual Vector<std::string> Tags() const;
+			/** Whether this helper works with the given shared data. The parse master checks this once whenever its helpers
+			 *  or its shared data change, so the handlers don't need to check the type of the shared data per element
+			 *  @param sharedData The shared data the parse master updates
+			 *  @return True if the helper should take part in the parse
+			 */
+			virtual bool IsSharedDataSupported(const SharedData& sharedData) const;
+
 			/** Method to handle start of an element
-			 *  @param name The name of the element
-			 *  @param attributes A map of attribute names to values
+			 *  @param name The lower case name of the element
+			 *  @param attributes A view over the attributes of the element, valid only during this call
 			 *  @return Whether or not this helper handled the element start
 			 */
-			virtual bool StartElementHandler(SharedData& sharedData, const std::string& name, const HashMap<std::string, std::string>& attributes) = 0;
+			virtual bool StartElementHandler(SharedData& sharedData, const std::string& name, const XmlAttributes& attributes) = 0;
 
 			/** Method to handle end of an element
 			 *  @param name The name of the element
@@ -28,10 +42,12 @@ namespace AnonymousEngine
 			 */
 			virtual bool EndElementHandler(SharedData& sharedData, const std::string& name) = 0;
 
-			/** Method to handle the character data inside an element
-			 *  @param buffer A string buffer containing the char data
+			/** Method to handle the character data inside an element. The buffer points into the parser's memory and is
+			 *  not null terminated
+			 *  @param buffer The char data
+			 *  @param length The number of characters in the buffer
 			 */
-			virtual void CharDataHandler(SharedData& sharedData, const std::string& buffer);
+			virtual void CharDataHandler(SharedData& sharedData, const XML_Char* buffer, std::uint32_t length);
 
 			/** Creates a new helper of this type
 			 */
@@ -0,0 +1,302 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace AnonymousEngine
+{
+	namespace Core
+	{
+		#pragma region JobCounter
+
+		JobCounter::JobCounter() :
+			mValue(0), mMutex(), mContinuations()
+		{
+		}
+
+		bool JobCounter::IsDone() const
+		{
+			return mValue.load() == 0;
+		}
+
+		std::uint32_t JobCounter::Value() const
+		{
+			return mValue.load();
+		}
+
+		#pragma endregion
+
+		#pragma region JobSystem
+
+		thread_local const JobSystem* JobSystem::CurrentJobSystem = nullptr;
+		thread_local std::uint32_t JobSystem::CurrentQueueIndex = 0;
+
+		JobSystem::JobSystem(std::uint32_t workerCount) :
+			mQueues(), mWorkers(), mMainThreadQueue(), mMainThreadId(std::this_thread::get_id()), mSleepMutex(), mWakeUp(),
+			mQueuedJobs(0), mIsRunning(true)
+		{
+			// one deque for the main thread and one for every worker
+			for (std::uint32_t index = 0; index <= workerCount; ++index)
+			{
+				mQueues.PushBack(new WorkQueue());
+			}
+			for (std::uint32_t index = 1; index <= workerCount; ++index)
+			{
+				mWorkers.PushBack(new std::thread(&JobSystem::WorkerLoop, this, index));
+			}
+		}
+
+		JobSystem::~JobSystem()
+		{
+			mIsRunning = false;
+			{
+				std::lock_guard<std::mutex> lock(mSleepMutex);
+			}
+			mWakeUp.notify_all();
+
+			for (auto worker : mWorkers)
+			{
+				worker->join();
+				delete worker;
+			}
+			for (auto queue : mQueues)
+			{
+				delete queue;
+			}
+		}
+
+		void JobSystem::Run(const JobFunction& function, JobCounter* counter)
+		{
+			Increment(counter);
+			Submit({ function, counter });
+		}
+
+		void JobSystem::RunAfter(JobCounter& dependency, const JobFunction& function, JobCounter* counter)
+		{
+			Increment(counter);
+			Job job = { function, counter };
+			{
+				std::lock_guard<std::mutex> lock(dependency.mMutex);
+				if (dependency.mValue.load() != 0)
+				{
+					dependency.mContinuations.PushBack(job);
+					return;
+				}
+			}
+			Submit(job);
+		}
+
+		void JobSystem::RunOnMainThread(const JobFunction& function, JobCounter* counter)
+		{
+			Increment(counter);
+			std::lock_guard<std::mutex> lock(mMainThreadQueue.mMutex);
+			mMainThreadQueue.mJobs.push_back({ function, counter });
+		}
+
+		void JobSystem::Wait(JobCounter& counter)
+		{
+			std::uint32_t queueIndex = QueueIndex();
+			while (!counter.IsDone())
+			{
+				if (!TryRunOne(queueIndex))
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			// the thread which brought the counter to zero may still be releasing its continuations
+			std::lock_guard<std::mutex> lock(counter.mMutex);
+		}
+
+		void JobSystem::ParallelFor(std::uint32_t begin, std::uint32_t end, const RangeFunction& function, std::uint32_t grainSize)
+		{
+			if (begin >= end)
+			{
+				return;
+			}
+
+			if (grainSize == 0)
+			{
+				grainSize = std::max((end - begin) / ((WorkerCount() + 1) * 4), 1U);
+			}
+
+			JobCounter counter;
+			std::uint32_t chunkBegin = begin;
+			while (chunkBegin < end)
+			{
+				std::uint32_t chunkEnd = chunkBegin + std::min(grainSize, end - chunkBegin);
+				Run([&function, chunkBegin, chunkEnd]() { function(chunkBegin, chunkEnd); }, &counter);
+				chunkBegin = chunkEnd;
+			}
+			Wait(counter);
+		}
+
+		std::uint32_t JobSystem::ProcessMainThreadJobs()
+		{
+			if (!IsMainThread())
+			{
+				throw std::runtime_error("Main thread jobs can only be processed on the main thread.");
+			}
+
+			std::uint32_t count = 0;
+			Job job;
+			while (TryPopMainThread(job))
+			{
+				job.mFunction();
+				Complete(job.mCounter);
+				++count;
+			}
+			return count;
+		}
+
+		std::uint32_t JobSystem::WorkerCount() const
+		{
+			return mWorkers.Size();
+		}
+
+		bool JobSystem::IsMainThread() const
+		{
+			return std::this_thread::get_id() == mMainThreadId;
+		}
+
+		std::uint32_t JobSystem::DefaultWorkerCount()
+		{
+			std::uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			return (hardwareThreads > 1) ? (hardwareThreads - 1) : 0;
+		}
+
+		void JobSystem::WorkerLoop(std::uint32_t queueIndex)
+		{
+			CurrentJobSystem = this;
+			CurrentQueueIndex = queueIndex;
+
+			while (mIsRunning)
+			{
+				if (TryRunOne(queueIndex))
+				{
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(mSleepMutex);
+				mWakeUp.wait(lock, [this]() { return !mIsRunning || mQueuedJobs.load() > 0; });
+			}
+		}
+
+		void JobSystem::Submit(const Job& job)
+		{
+			WorkQueue& queue = *mQueues[QueueIndex()];
+			{
+				std::lock_guard<std::mutex> lock(queue.mMutex);
+				queue.mJobs.push_back(job);
+				++mQueuedJobs;
+			}
+
+			// taking the lock makes sure a worker is either before its check or already waiting
+			{
+				std::lock_guard<std::mutex> lock(mSleepMutex);
+			}
+			mWakeUp.notify_one();
+		}
+
+		void JobSystem::Increment(JobCounter* counter)
+		{
+			if (counter != nullptr)
+			{
+				++counter->mValue;
+			}
+		}
+
+		void JobSystem::Complete(JobCounter* counter)
+		{
+			if (counter == nullptr)
+			{
+				return;
+			}
+
+			SList<Job> continuations;
+			{
+				std::lock_guard<std::mutex> lock(counter->mMutex);
+				if (--counter->mValue == 0)
+				{
+					continuations = std::move(counter->mContinuations);
+				}
+			}
+
+			for (const auto& job : continuations)
+			{
+				Submit(job);
+			}
+		}
+
+		bool JobSystem::TryRunOne(std::uint32_t queueIndex)
+		{
+			Job job;
+			if (IsMainThread() && TryPopMainThread(job))
+			{
+				job.mFunction();
+				Complete(job.mCounter);
+				return true;
+			}
+
+			if (TryPop(queueIndex, job) || TrySteal(queueIndex, job))
+			{
+				job.mFunction();
+				Complete(job.mCounter);
+				return true;
+			}
+			return false;
+		}
+
+		bool JobSystem::TryPop(std::uint32_t queueIndex, Job& job)
+		{
+			WorkQueue& queue = *mQueues[queueIndex];
+			std::lock_guard<std::mutex> lock(queue.mMutex);
+			if (queue.mJobs.empty())
+			{
+				return false;
+			}
+
+			job = std::move(queue.mJobs.back());
+			queue.mJobs.pop_back();
+			--mQueuedJobs;
+			return true;
+		}
+
+		bool JobSystem::TrySteal(std::uint32_t queueIndex, Job& job)
+		{
+			std::uint32_t queueCount = mQueues.Size();
+			for (std::uint32_t offset = 1; offset < queueCount; ++offset)
+			{
+				WorkQueue& queue = *mQueues[(queueIndex + offset) % queueCount];
+				std::lock_guard<std::mutex> lock(queue.mMutex);
+				if (!queue.mJobs.empty())
+				{
+					job = std::move(queue.mJobs.front());
+					queue.mJobs.pop_front();
+					--mQueuedJobs;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool JobSystem::TryPopMainThread(Job& job)
+		{
+			std::lock_guard<std::mutex> lock(mMainThreadQueue.mMutex);
+			if (mMainThreadQueue.mJobs.empty())
+			{
+				return false;
+			}
+
+			job = std::move(mMainThreadQueue.mJobs.front());
+			mMainThreadQueue.mJobs.pop_front();
+			return true;
+		}
+
+		std::uint32_t JobSystem::QueueIndex() const
+		{
+			// the main thread and threads outside this job system share the first deque
+			return (CurrentJobSystem == this) ? CurrentQueueIndex : 0;
+		}
+
+		#pragma endregion
+	}
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "SList.h"
+#include "Vector.h"
+
+namespace AnonymousEngine
+{
+	namespace Core
+	{
+		class JobCounter;
+
+		/** A unit of work scheduled on a job system
+		 */
+		struct Job
+		{
+			/** The work to do
+			 */
+			std::function<void()> mFunction;
+			/** The counter decremented once the work is done. Can be null
+			 */
+			JobCounter* mCounter;
+		};
+
+		/** Tracks the number of outstanding jobs in a group. Every job run against a counter increments it and decrements
+		 *  it when done, so a counter at zero means the whole group has finished. Counters are also used as dependencies,
+		 *  jobs run after a counter are held back until it reaches zero
+		 */
+		class JobCounter final
+		{
+		public:
+			/** Initialize a counter with no outstanding jobs
+			 */
+			JobCounter();
+			/** Free up any resources allocated by the instance. The counter should not have outstanding jobs
+			 */
+			~JobCounter() = default;
+
+			// Delete move and copy semantics
+			JobCounter(const JobCounter&) = delete;
+			JobCounter& operator=(const JobCounter&) = delete;
+
+			/** Whether all the jobs run against this counter are done
+			 *  @return True if there are no outstanding jobs
+			 */
+			bool IsDone() const;
+			/** The number of outstanding jobs
+			 *  @return The current value of the counter
+			 */
+			std::uint32_t Value() const;
+		private:
+			// Number of outstanding jobs
+			std::atomic<std::uint32_t> mValue;
+			// Guards the continuations and the transition to zero
+			std::mutex mMutex;
+			// Jobs waiting for this counter to reach zero
+			SList<Job> mContinuations;
+
+			friend class JobSystem;
+		};
+
+		/** A work stealing job scheduler. Every thread owns a deque of jobs, it pushes and pops its own jobs from the back
+		 *  and when it runs dry it steals the oldest jobs from the front of the other deques. The thread that creates the
+		 *  job system is treated as the main thread, it takes part in the work whenever it waits on a counter and is the
+		 *  only thread that runs jobs with main thread affinity. Jobs should not throw
+		 */
+		class JobSystem final
+		{
+		public:
+			typedef std::function<void()> JobFunction;
+			typedef std::function<void(std::uint32_t, std::uint32_t)> RangeFunction;
+
+			/** Start a job system and its worker threads. The calling thread becomes the main thread
+			 *  @param workerCount The number of worker threads to start besides the main thread. Can be zero, in which
+			 *  case all jobs are run by the main thread while it waits
+			 */
+			explicit JobSystem(std::uint32_t workerCount = DefaultWorkerCount());
+			/** Stop and join all the worker threads. Jobs which were not started by then are dropped
+			 */
+			~JobSystem();
+
+			// Delete move and copy semantics
+			JobSystem(const JobSystem&) = delete;
+			JobSystem& operator=(const JobSystem&) = delete;
+
+			/** Schedule a job on any thread
+			 *  @param function The work to do
+			 *  @param counter The counter to track the job with. Can be null
+			 */
+			void Run(const JobFunction& function, JobCounter* counter = nullptr);
+			/** Schedule a job on any thread once all the jobs of another counter are done
+			 *  @param dependency The counter to wait for. It should outlive the scheduled job
+			 *  @param function The work to do
+			 *  @param counter The counter to track the job with. Can be null
+			 */
+			void RunAfter(JobCounter& dependency, const JobFunction& function, JobCounter* counter = nullptr);
+			/** Schedule a job which has to run on the main thread. It runs when the main thread waits on a counter or
+			 *  calls ProcessMainThreadJobs
+			 *  @param function The work to do
+			 *  @param counter The counter to track the job with. Can be null
+			 */
+			void RunOnMainThread(const JobFunction& function, JobCounter* counter = nullptr);
+
+			/** Block until all the jobs of a counter are done. The calling thread runs other jobs meanwhile
+			 *  @param counter The counter to wait on
+			 */
+			void Wait(JobCounter& counter);
+
+			/** Split an index range into chunks, run the chunks in parallel and wait for all of them
+			 *  @param begin The first index of the range
+			 *  @param end One past the last index of the range
+			 *  @param function Called with the [begin, end) bounds of every chunk
+			 *  @param grainSize The number of indices per chunk. Zero picks a size which gives every thread a few chunks
+			 */
+			void ParallelFor(std::uint32_t begin, std::uint32_t end, const RangeFunction& function, std::uint32_t grainSize = 0);
+
+			/** Run all the main thread jobs queued till now. Should be called from the main thread
+			 *  @return The number of jobs that were run
+			 *  @exception std::runtime_error Thrown if called from any other thread
+			 */
+			std::uint32_t ProcessMainThreadJobs();
+
+			/** The number of worker threads, not counting the main thread
+			 *  @return The worker count
+			 */
+			std::uint32_t WorkerCount() const;
+			/** Whether the calling thread is the main thread of this job system
+			 *  @return True if called from the main thread
+			 */
+			bool IsMainThread() const;
+
+			/** The worker count that keeps every hardware thread busy alongside the main thread
+			 *  @return One less than the number of hardware threads, or zero if that is unknown
+			 */
+			static std::uint32_t DefaultWorkerCount();
+		private:
+			// A deque of jobs owned by one thread
+			struct WorkQueue
+			{
+				std::mutex mMutex;
+				std::deque<Job> mJobs;
+			};
+
+			// Body of every worker thread
+			void WorkerLoop(std::uint32_t queueIndex);
+			// Push a job to the deque of the calling thread
+			void Submit(const Job& job);
+			// Increment a counter for a newly scheduled job
+			static void Increment(JobCounter* counter);
+			// Decrement a counter for a finished job, releasing its continuations if it reaches zero
+			void Complete(JobCounter* counter);
+			// Run one job from the calling thread's deque, the main thread queue or by stealing
+			bool TryRunOne(std::uint32_t queueIndex);
+			// Pop the newest job from the given deque
+			bool TryPop(std::uint32_t queueIndex, Job& job);
+			// Steal the oldest job from any deque other than the given one
+			bool TrySteal(std::uint32_t queueIndex, Job& job);
+			// Pop a job with main thread affinity
+			bool TryPopMainThread(Job& job);
+			// Index of the calling thread's deque
+			std::uint32_t QueueIndex() const;
+
+			// One deque per thread, the main thread's is at index zero
+			Vector<WorkQueue*> mQueues;
+			// The worker threads
+			Vector<std::thread*> mWorkers;
+			// Jobs which have to run on the main thread
+			WorkQueue mMainThreadQueue;
+			// The thread which created the job system
+			std::thread::id mMainThreadId;
+			// Idle workers sleep on this till jobs are queued
+			std::mutex mSleepMutex;
+			std::condition_variable mWakeUp;
+			// Number of jobs sitting in the deques
+			std::atomic<std::uint32_t> mQueuedJobs;
+			// Cleared to stop the workers
+			std::atomic<bool> mIsRunning;
+
+			// The job system the calling thread works for
+			static thread_local const JobSystem* CurrentJobSystem;
+			// The deque index of the calling thread in CurrentJobSystem
+			static thread_local std::uint32_t CurrentQueueIndex;
+		};
+	}
+}
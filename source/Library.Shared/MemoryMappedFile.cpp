@@ -0,0 +1,222 @@
+#include "MemoryMappedFile.h"
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace AnonymousEngine
+{
+	MemoryMappedFile::MemoryMappedFile() :
+#ifdef _WIN32
+		mData(nullptr), mSize(0), mIsOpen(false), mAccess(Access::ReadOnly), mFile(INVALID_HANDLE_VALUE), mMapping(nullptr)
+#else
+		mData(nullptr), mSize(0), mIsOpen(false), mAccess(Access::ReadOnly), mFile(-1)
+#endif
+	{
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& filename, Access access) :
+		MemoryMappedFile()
+	{
+		Open(filename, access);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		Close();
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs) noexcept :
+		MemoryMappedFile()
+	{
+		Move(rhs);
+	}
+
+	MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Close();
+			Move(rhs);
+		}
+		return *this;
+	}
+
+#ifdef _WIN32
+	void MemoryMappedFile::Open(const std::string& filename, Access access)
+	{
+		Close();
+		mAccess = access;
+
+		mFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (mFile == INVALID_HANDLE_VALUE)
+		{
+			throw std::runtime_error(std::string("Unable to open file for mapping. filename = ").append(filename));
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(mFile, &size))
+		{
+			Close();
+			throw std::runtime_error(std::string("Unable to read the size of the file. filename = ").append(filename));
+		}
+		mSize = static_cast<std::uint64_t>(size.QuadPart);
+		mIsOpen = true;
+
+		// empty files can't be mapped
+		if (mSize == 0)
+		{
+			return;
+		}
+
+		bool copyOnWrite = (access == Access::CopyOnWrite);
+		mMapping = CreateFileMappingA(mFile, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+		if (mMapping != nullptr)
+		{
+			mData = static_cast<const char*>(MapViewOfFile(mMapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0));
+		}
+		if (mData == nullptr)
+		{
+			Close();
+			throw std::runtime_error(std::string("Unable to map file. filename = ").append(filename));
+		}
+	}
+
+	void MemoryMappedFile::Close()
+	{
+		if (mData != nullptr)
+		{
+			UnmapViewOfFile(mData);
+		}
+		if (mMapping != nullptr)
+		{
+			CloseHandle(mMapping);
+		}
+		if (mFile != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(mFile);
+		}
+		mData = nullptr;
+		mSize = 0;
+		mIsOpen = false;
+		mAccess = Access::ReadOnly;
+		mFile = INVALID_HANDLE_VALUE;
+		mMapping = nullptr;
+	}
+
+	void MemoryMappedFile::Move(MemoryMappedFile& rhs)
+	{
+		mData = rhs.mData;
+		mSize = rhs.mSize;
+		mIsOpen = rhs.mIsOpen;
+		mAccess = rhs.mAccess;
+		mFile = rhs.mFile;
+		mMapping = rhs.mMapping;
+		rhs.mData = nullptr;
+		rhs.mSize = 0;
+		rhs.mIsOpen = false;
+		rhs.mAccess = Access::ReadOnly;
+		rhs.mFile = INVALID_HANDLE_VALUE;
+		rhs.mMapping = nullptr;
+	}
+#else
+	void MemoryMappedFile::Open(const std::string& filename, Access access)
+	{
+		Close();
+		mAccess = access;
+
+		mFile = open(filename.c_str(), O_RDONLY);
+		if (mFile == -1)
+		{
+			throw std::runtime_error(std::string("Unable to open file for mapping. filename = ").append(filename));
+		}
+
+		struct stat status;
+		if (fstat(mFile, &status) != 0)
+		{
+			Close();
+			throw std::runtime_error(std::string("Unable to read the size of the file. filename = ").append(filename));
+		}
+		mSize = static_cast<std::uint64_t>(status.st_size);
+		mIsOpen = true;
+
+		// empty files can't be mapped
+		if (mSize == 0)
+		{
+			return;
+		}
+
+		// a private mapping is already copy on write, it only needs to allow writes
+		int protection = (access == Access::CopyOnWrite) ? (PROT_READ | PROT_WRITE) : PROT_READ;
+		void* data = mmap(nullptr, static_cast<size_t>(mSize), protection, MAP_PRIVATE, mFile, 0);
+		if (data == MAP_FAILED)
+		{
+			Close();
+			throw std::runtime_error(std::string("Unable to map file. filename = ").append(filename));
+		}
+		if (access == Access::ReadOnly)
+		{
+			madvise(data, static_cast<size_t>(mSize), MADV_SEQUENTIAL);
+		}
+		mData = static_cast<const char*>(data);
+	}
+
+	void MemoryMappedFile::Close()
+	{
+		if (mData != nullptr)
+		{
+			munmap(const_cast<char*>(mData), static_cast<size_t>(mSize));
+		}
+		if (mFile != -1)
+		{
+			close(mFile);
+		}
+		mData = nullptr;
+		mSize = 0;
+		mIsOpen = false;
+		mAccess = Access::ReadOnly;
+		mFile = -1;
+	}
+
+	void MemoryMappedFile::Move(MemoryMappedFile& rhs)
+	{
+		mData = rhs.mData;
+		mSize = rhs.mSize;
+		mIsOpen = rhs.mIsOpen;
+		mAccess = rhs.mAccess;
+		mFile = rhs.mFile;
+		rhs.mData = nullptr;
+		rhs.mSize = 0;
+		rhs.mIsOpen = false;
+		rhs.mAccess = Access::ReadOnly;
+		rhs.mFile = -1;
+	}
+#endif
+
+	bool MemoryMappedFile::IsOpen() const
+	{
+		return mIsOpen;
+	}
+
+	const char* MemoryMappedFile::Data() const
+	{
+		return mData;
+	}
+
+	char* MemoryMappedFile::MutableData() const
+	{
+		return (mAccess == Access::CopyOnWrite) ? const_cast<char*>(mData) : nullptr;
+	}
+
+	std::uint64_t MemoryMappedFile::Size() const
+	{
+		return mSize;
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace AnonymousEngine
+{
+	/** A read only view of a whole file mapped into memory. Pages are loaded on demand by the operating system and are
+	 *  shared with its file cache, so reading a file that was read recently involves no copy at all
+	 */
+	class MemoryMappedFile final
+	{
+	public:
+		/** How the pages of a mapped file can be accessed
+		 */
+		enum class Access
+		{
+			// Pages can only be read
+			ReadOnly,
+			// Pages can be written, a written page becomes a private copy and the file is never modified
+			CopyOnWrite
+		};
+
+		/** Initialize an instance which does not map any file
+		 */
+		MemoryMappedFile();
+		/** Map a file into memory
+		 *  @param filename The path of the file to map
+		 *  @param access How the pages of the file can be accessed
+		 *  @exception std::runtime_error Thrown if the file can't be opened or mapped
+		 */
+		explicit MemoryMappedFile(const std::string& filename, Access access = Access::ReadOnly);
+		/** Unmap the file if one is mapped
+		 */
+		~MemoryMappedFile();
+
+		// Delete copy semantics, a mapping has a single owner
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+		/** Take over the mapping of another instance
+		 *  @param rhs The instance to move from. It does not map any file afterwards
+		 */
+		MemoryMappedFile(MemoryMappedFile&& rhs) noexcept;
+		/** Unmap the current file and take over the mapping of another instance
+		 *  @param rhs The instance to move from. It does not map any file afterwards
+		 *  @return A reference to this instance
+		 */
+		MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+
+		/** Map a file into memory, unmapping the current one first
+		 *  @param filename The path of the file to map
+		 *  @param access How the pages of the file can be accessed
+		 *  @exception std::runtime_error Thrown if the file can't be opened or mapped
+		 */
+		void Open(const std::string& filename, Access access = Access::ReadOnly);
+		/** Unmap the current file. Does nothing if no file is mapped
+		 */
+		void Close();
+
+		/** Whether a file is mapped
+		 *  @return True if a file is mapped
+		 */
+		bool IsOpen() const;
+		/** The contents of the mapped file
+		 *  @return A pointer to the first byte of the file. Null if the file is empty or nothing is mapped
+		 */
+		const char* Data() const;
+		/** The contents of a file mapped copy on write. Pages stay shared with the file cache until they are written
+		 *  @return A pointer to the first byte of the file. Null if the file is empty, nothing is mapped or the file is
+		 *  mapped read only
+		 */
+		char* MutableData() const;
+		/** The size of the mapped file
+		 *  @return The number of bytes in the file
+		 */
+		std::uint64_t Size() const;
+
+	private:
+		// Take over the state of another instance
+		void Move(MemoryMappedFile& rhs);
+
+		// The start of the mapped view
+		const char* mData;
+		// The size of the file in bytes
+		std::uint64_t mSize;
+		// Whether a file is mapped
+		bool mIsOpen;
+		// How the pages of the mapped file can be accessed
+		Access mAccess;
+#ifdef _WIN32
+		// The file and file mapping handles
+		void* mFile;
+		void* mMapping;
+#else
+		// The file descriptor
+		int mFile;
+#endif
+	};
+}
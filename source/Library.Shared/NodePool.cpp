@@ -0,0 +1,181 @@
+#include "NodePool.h"
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+namespace AnonymousEngine
+{
+	const std::uint32_t NodePool::FirstSlabBlocks = 4U;
+	const std::uint32_t NodePool::MaxSlabBlocks = 1024U;
+
+	// Every block and the slab header are padded to this, which operator new already aligns slabs to
+	static const std::size_t BlockAlignment = alignof(std::max_align_t);
+
+	static std::size_t AlignUp(std::size_t size)
+	{
+		return (size + BlockAlignment - 1) / BlockAlignment * BlockAlignment;
+	}
+
+	NodePool::NodePool(std::uint32_t firstSlabBlocks) :
+		mSlabs(nullptr), mFreeBlocks(nullptr), mBlockSize(0), mFirstSlabBlocks(firstSlabBlocks), mNextSlabBlocks(firstSlabBlocks), mSlabCount(0)
+	{
+		if (firstSlabBlocks == 0 || firstSlabBlocks > MaxSlabBlocks)
+		{
+			throw std::invalid_argument("The first slab has to hold between one and MaxSlabBlocks blocks.");
+		}
+	}
+
+	NodePool::~NodePool()
+	{
+		Release();
+	}
+
+	NodePool::NodePool(NodePool&& rhs) noexcept :
+		mSlabs(rhs.mSlabs), mFreeBlocks(rhs.mFreeBlocks), mBlockSize(rhs.mBlockSize), mFirstSlabBlocks(rhs.mFirstSlabBlocks), mNextSlabBlocks(rhs.mNextSlabBlocks), mSlabCount(rhs.mSlabCount)
+	{
+		rhs.mSlabs = nullptr;
+		rhs.mFreeBlocks = nullptr;
+		rhs.mBlockSize = 0;
+		rhs.mNextSlabBlocks = rhs.mFirstSlabBlocks;
+		rhs.mSlabCount = 0;
+	}
+
+	NodePool& NodePool::operator=(NodePool&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Release();
+			std::swap(mSlabs, rhs.mSlabs);
+			std::swap(mFreeBlocks, rhs.mFreeBlocks);
+			std::swap(mBlockSize, rhs.mBlockSize);
+			std::swap(mFirstSlabBlocks, rhs.mFirstSlabBlocks);
+			std::swap(mNextSlabBlocks, rhs.mNextSlabBlocks);
+			std::swap(mSlabCount, rhs.mSlabCount);
+		}
+		return *this;
+	}
+
+	void* NodePool::Allocate(std::size_t size)
+	{
+		if (mBlockSize == 0)
+		{
+			mBlockSize = AlignUp(std::max(size, sizeof(FreeBlock)));
+		}
+		else if (size > mBlockSize)
+		{
+			throw std::invalid_argument("Size is larger than the blocks of the pool.");
+		}
+
+		if (mFreeBlocks == nullptr)
+		{
+			AddSlab();
+		}
+		FreeBlock* block = mFreeBlocks;
+		mFreeBlocks = block->mNext;
+		return block;
+	}
+
+	void NodePool::Free(void* block)
+	{
+		if (block != nullptr)
+		{
+			FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+			freeBlock->mNext = mFreeBlocks;
+			mFreeBlocks = freeBlock;
+		}
+	}
+
+	void NodePool::Release()
+	{
+		while (mSlabs != nullptr)
+		{
+			Slab* next = mSlabs->mNext;
+			::operator delete(mSlabs);
+			mSlabs = next;
+		}
+		mFreeBlocks = nullptr;
+		mNextSlabBlocks = mFirstSlabBlocks;
+		mSlabCount = 0;
+	}
+
+	std::uint32_t NodePool::SlabCount() const
+	{
+		return mSlabCount;
+	}
+
+	void NodePool::AddSlab()
+	{
+		std::size_t headerSize = AlignUp(sizeof(Slab));
+		char* memory = static_cast<char*>(::operator new(headerSize + mBlockSize * mNextSlabBlocks));
+		Slab* slab = reinterpret_cast<Slab*>(memory);
+		slab->mNext = mSlabs;
+		mSlabs = slab;
+		++mSlabCount;
+
+		// thread the blocks onto the free list in address order, so nodes allocated together sit together
+		char* blocks = memory + headerSize;
+		for (std::uint32_t index = mNextSlabBlocks; index > 0; --index)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + (index - 1) * mBlockSize);
+			block->mNext = mFreeBlocks;
+			mFreeBlocks = block;
+		}
+		mNextSlabBlocks = std::min(mNextSlabBlocks * 2, MaxSlabBlocks);
+	}
+
+	PooledNodeAllocator::PooledNodeAllocator() :
+		mPool(1U)
+	{
+	}
+
+	PooledNodeAllocator::PooledNodeAllocator(const PooledNodeAllocator&) :
+		mPool(1U)
+	{
+	}
+
+	PooledNodeAllocator& PooledNodeAllocator::operator=(const PooledNodeAllocator&)
+	{
+		return *this;
+	}
+
+	void* PooledNodeAllocator::Allocate(std::size_t size)
+	{
+		return mPool.Allocate(size);
+	}
+
+	void PooledNodeAllocator::Free(void* block)
+	{
+		mPool.Free(block);
+	}
+
+	void PooledNodeAllocator::Release()
+	{
+		mPool.Release();
+	}
+
+	SharedNodeAllocator::SharedNodeAllocator(NodePool* pool) :
+		mPool(pool)
+	{
+	}
+
+	void* SharedNodeAllocator::Allocate(std::size_t size)
+	{
+		return (mPool != nullptr) ? mPool->Allocate(size) : ::operator new(size);
+	}
+
+	void SharedNodeAllocator::Free(void* block)
+	{
+		if (mPool != nullptr)
+		{
+			mPool->Free(block);
+		}
+		else
+		{
+			::operator delete(block);
+		}
+	}
+
+	void SharedNodeAllocator::Release()
+	{
+	}
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AnonymousEngine
+{
+	/** A pool of equally sized blocks for the nodes of linked containers. Blocks are carved out of slabs which grow
+	 *  geometrically up to MaxSlabBlocks blocks, and freed blocks go on a free list to be handed out again, so a
+	 *  container which keeps inserting and removing stops calling the general purpose allocator altogether. Blocks are
+	 *  aligned for any fundamental type. A pool is not thread safe
+	 */
+	class NodePool final
+	{
+	public:
+		/** Initialize an empty pool. Nothing is allocated until the first block is
+		 *  @param firstSlabBlocks The number of blocks in the first slab, which doubles with every slab after it
+		 *  @exception std::invalid_argument Thrown if the number of blocks is zero or larger than MaxSlabBlocks
+		 */
+		explicit NodePool(std::uint32_t firstSlabBlocks = FirstSlabBlocks);
+		/** Free every slab of the pool
+		 */
+		~NodePool();
+
+		// Delete copy semantics
+		NodePool(const NodePool&) = delete;
+		NodePool& operator=(const NodePool&) = delete;
+
+		/** Take over the slabs of another pool, leaving it empty
+		 *  @param rhs The pool to move from
+		 */
+		NodePool(NodePool&& rhs) noexcept;
+		/** Free the slabs of this pool and take over the slabs of another pool, leaving it empty
+		 *  @param rhs The pool to move from
+		 *  @return A reference to this pool
+		 */
+		NodePool& operator=(NodePool&& rhs) noexcept;
+
+		/** Get a block from the pool. The first allocation fixes the block size of the pool
+		 *  @param size The size of the block, which can't be larger than the block size of the pool
+		 *  @return The block
+		 *  @exception std::invalid_argument Thrown if the size is larger than the block size of the pool
+		 */
+		void* Allocate(std::size_t size);
+		/** Return a block to the pool
+		 *  @param block A block allocated from this pool
+		 */
+		void Free(void* block);
+		/** Free every slab of the pool. Every block has to have been returned already
+		 */
+		void Release();
+		/** Get the number of slabs the pool holds
+		 *  @return The number of slabs
+		 */
+		std::uint32_t SlabCount() const;
+
+		/** The number of blocks in the first slab of a pool, unless it is given another one
+		 */
+		static const std::uint32_t FirstSlabBlocks;
+		/** The largest number of blocks in one slab
+		 */
+		static const std::uint32_t MaxSlabBlocks;
+
+	private:
+		// The header at the start of every slab
+		struct Slab
+		{
+			Slab* mNext;
+		};
+		// A block on the free list
+		struct FreeBlock
+		{
+			FreeBlock* mNext;
+		};
+
+		// Allocate the next slab and put its blocks on the free list
+		void AddSlab();
+
+		// The slabs of the pool, most recent first
+		Slab* mSlabs;
+		// The blocks which are free to hand out
+		FreeBlock* mFreeBlocks;
+		// The size of every block, zero until the first allocation
+		std::size_t mBlockSize;
+		// The number of blocks in the first slab, which the pool goes back to when released
+		std::uint32_t mFirstSlabBlocks;
+		// The number of blocks in the next slab
+		std::uint32_t mNextSlabBlocks;
+		// The number of slabs
+		std::uint32_t mSlabCount;
+	};
+
+	/** The default node allocator of SList. Every list owns a NodePool, which it releases when it is cleared, so nodes
+	 *  which are removed and inserted again reuse their memory. The first slab of the pool holds a single node, so the
+	 *  many lists which only ever hold an item or two cost no more than with operator new
+	 */
+	class PooledNodeAllocator final
+	{
+	public:
+		/** Initialize an allocator with an empty pool
+		 */
+		PooledNodeAllocator();
+		/** A copy gets its own empty pool, since the nodes of the original stay with the original
+		 */
+		PooledNodeAllocator(const PooledNodeAllocator&);
+		/** The pool stays with the allocator, since it holds the nodes of the list
+		 *  @return A reference to this allocator
+		 */
+		PooledNodeAllocator& operator=(const PooledNodeAllocator&);
+		/** Take over the pool, and the nodes in it, from another allocator
+		 */
+		PooledNodeAllocator(PooledNodeAllocator&& rhs) noexcept = default;
+		/** Take over the pool, and the nodes in it, from another allocator
+		 *  @return A reference to this allocator
+		 */
+		PooledNodeAllocator& operator=(PooledNodeAllocator&& rhs) noexcept = default;
+
+		/** Allocate memory for a node
+		 *  @param size The size of the node
+		 *  @return The memory
+		 */
+		void* Allocate(std::size_t size);
+		/** Free the memory of a node
+		 *  @param block The memory of the node
+		 */
+		void Free(void* block);
+		/** Free the memory held for future nodes. Called when the list is cleared
+		 */
+		void Release();
+
+	private:
+		NodePool mPool;
+	};
+
+	/** A node allocator which takes nodes from a pool owned by someone else, such as the pool a HashMap shares between
+	 *  all its chains. Without a pool it uses operator new
+	 */
+	class SharedNodeAllocator final
+	{
+	public:
+		/** Initialize an allocator
+		 *  @param pool The pool to take nodes from. It has to outlive every node taken from it
+		 */
+		explicit SharedNodeAllocator(NodePool* pool = nullptr);
+
+		/** Allocate memory for a node
+		 *  @param size The size of the node
+		 *  @return The memory
+		 */
+		void* Allocate(std::size_t size);
+		/** Free the memory of a node
+		 *  @param block The memory of the node
+		 */
+		void Free(void* block);
+		/** Does nothing, the pool is released by its owner
+		 */
+		void Release();
+
+	private:
+		NodePool* mPool;
+	};
+}
@@ -0,0 +1,268 @@
+#include "NumberParser.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+
+namespace AnonymousEngine
+{
+	const double NumberParser::PowersOfTen[23] =
+	{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	const char* NumberParser::Parse(const char* begin, const char* end, std::int32_t& value)
+	{
+		const char* position = SkipWhitespace(begin, end);
+		bool isNegative = false;
+		if (position != end && (*position == '+' || *position == '-'))
+		{
+			isNegative = (*position == '-');
+			++position;
+		}
+
+		const char* digits = position;
+		std::int64_t magnitude = 0;
+		std::int64_t limit = isNegative ? -static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::min()) : std::numeric_limits<std::int32_t>::max();
+		bool isOutOfRange = false;
+		for (; position != end && *position >= '0' && *position <= '9'; ++position)
+		{
+			magnitude = magnitude * 10 + (*position - '0');
+			if (magnitude > limit)
+			{
+				// keep consuming digits so a huge number doesn't overflow the accumulator
+				isOutOfRange = true;
+				magnitude = limit;
+			}
+		}
+		if (position == digits)
+		{
+			throw std::invalid_argument("Text doesn't start with an integer.");
+		}
+		if (isOutOfRange)
+		{
+			throw std::out_of_range("Integer doesn't fit in 32 bits.");
+		}
+
+		value = static_cast<std::int32_t>(isNegative ? -magnitude : magnitude);
+		return position;
+	}
+
+	const char* NumberParser::Parse(const char* begin, const char* end, float& value)
+	{
+		const char* start = SkipWhitespace(begin, end);
+		const char* position = start;
+		bool isNegative = false;
+		if (position != end && (*position == '+' || *position == '-'))
+		{
+			isNegative = (*position == '-');
+			++position;
+		}
+
+		if (StartsWith(position, end, "inf"))
+		{
+			position += StartsWith(position, end, "infinity") ? 8 : 3;
+			value = isNegative ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+			return position;
+		}
+		if (StartsWith(position, end, "nan"))
+		{
+			value = std::numeric_limits<float>::quiet_NaN();
+			return position + 3;
+		}
+
+		// gather up to 19 significant digits, which always fit in 64 bits, and track the decimal exponent
+		const std::uint32_t MaxDigits = 19;
+		std::uint64_t mantissa = 0;
+		std::uint32_t digitCount = 0;
+		std::int32_t exponent = 0;
+		bool hasDigits = false;
+		bool isTruncated = false;
+		for (; position != end && *position >= '0' && *position <= '9'; ++position)
+		{
+			hasDigits = true;
+			if (digitCount < MaxDigits)
+			{
+				mantissa = mantissa * 10 + (*position - '0');
+				digitCount += (mantissa != 0) ? 1 : 0;
+			}
+			else
+			{
+				++exponent;
+				isTruncated |= (*position != '0');
+			}
+		}
+		if (position != end && *position == '.')
+		{
+			++position;
+			for (; position != end && *position >= '0' && *position <= '9'; ++position)
+			{
+				hasDigits = true;
+				if (digitCount < MaxDigits)
+				{
+					mantissa = mantissa * 10 + (*position - '0');
+					digitCount += (mantissa != 0) ? 1 : 0;
+					--exponent;
+				}
+				else
+				{
+					isTruncated |= (*position != '0');
+				}
+			}
+		}
+		if (!hasDigits)
+		{
+			throw std::invalid_argument("Text doesn't start with a float.");
+		}
+
+		// an exponent marker without digits is not part of the number
+		if (position != end && (*position == 'e' || *position == 'E'))
+		{
+			const char* exponentPosition = position + 1;
+			bool isExponentNegative = false;
+			if (exponentPosition != end && (*exponentPosition == '+' || *exponentPosition == '-'))
+			{
+				isExponentNegative = (*exponentPosition == '-');
+				++exponentPosition;
+			}
+			if (exponentPosition != end && *exponentPosition >= '0' && *exponentPosition <= '9')
+			{
+				std::int32_t exponentValue = 0;
+				for (; exponentPosition != end && *exponentPosition >= '0' && *exponentPosition <= '9'; ++exponentPosition)
+				{
+					if (exponentValue < 100000)
+					{
+						exponentValue = exponentValue * 10 + (*exponentPosition - '0');
+					}
+				}
+				exponent += isExponentNegative ? -exponentValue : exponentValue;
+				position = exponentPosition;
+			}
+		}
+
+		if (mantissa == 0)
+		{
+			value = isNegative ? -0.0f : 0.0f;
+			return position;
+		}
+
+		// both the mantissa and the power of ten are exact doubles, so the double result is correctly rounded and lies
+		// within the normal float range. Converting it to a float rounds correctly unless it sits exactly on a midpoint
+		const std::uint64_t MaxExactMantissa = 1ULL << 53;
+		if (!isTruncated && mantissa <= MaxExactMantissa && exponent >= -22 && exponent <= 22)
+		{
+			double result = static_cast<double>(mantissa);
+			result = (exponent < 0) ? result / PowersOfTen[-exponent] : result * PowersOfTen[exponent];
+			if (!IsFloatMidpoint(result))
+			{
+				value = static_cast<float>(isNegative ? -result : result);
+				return position;
+			}
+		}
+
+		value = ParseSlow(start, position);
+		return position;
+	}
+
+	void NumberParser::Parse(const std::string& text, float* values, std::uint32_t count)
+	{
+		const char* position = text.c_str();
+		const char* end = position + text.size();
+		for (std::uint32_t index = 0; index < count; ++index)
+		{
+			if (index > 0)
+			{
+				if (position == end)
+				{
+					throw std::invalid_argument("Text has too few numbers.");
+				}
+				++position;
+			}
+			position = Parse(position, end, values[index]);
+		}
+	}
+
+	std::int32_t NumberParser::ToInt(const std::string& text)
+	{
+		std::int32_t value;
+		Parse(text.c_str(), text.c_str() + text.size(), value);
+		return value;
+	}
+
+	float NumberParser::ToFloat(const std::string& text)
+	{
+		float value;
+		Parse(text.c_str(), text.c_str() + text.size(), value);
+		return value;
+	}
+
+	const char* NumberParser::SkipWhitespace(const char* begin, const char* end)
+	{
+		while (begin != end && (*begin == ' ' || (*begin >= '\t' && *begin <= '\r')))
+		{
+			++begin;
+		}
+		return begin;
+	}
+
+	bool NumberParser::StartsWith(const char* begin, const char* end, const char* word)
+	{
+		for (; *word != '\0'; ++word, ++begin)
+		{
+			if (begin == end || (*begin | 0x20) != *word)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	float NumberParser::ParseSlow(const char* begin, const char* end)
+	{
+		std::istringstream stream(std::string(begin, end));
+		stream.imbue(std::locale::classic());
+		float value = 0.0f;
+		stream >> value;
+		if (stream.fail())
+		{
+			// streams report an overflow by failing with the largest value
+			if (value == std::numeric_limits<float>::max() || value == -std::numeric_limits<float>::max())
+			{
+				return RoundToLargestFloat(begin, end);
+			}
+			throw std::invalid_argument("Text doesn't start with a float.");
+		}
+		return value;
+	}
+
+	float NumberParser::RoundToLargestFloat(const char* begin, const char* end)
+	{
+		// some streams fail on anything above the largest float, even a number which rounds down to it like std::stof
+		// does. Anything short of halfway to the next power of two, the float after the largest one, rounds down
+		const double Largest = static_cast<double>(std::numeric_limits<float>::max());
+		const double Overflow = Largest + std::ldexp(1.0, std::numeric_limits<float>::max_exponent - std::numeric_limits<float>::digits - 1);
+
+		std::istringstream stream(std::string(begin, end));
+		stream.imbue(std::locale::classic());
+		double value = 0.0;
+		stream >> value;
+		if (stream.fail() || std::fabs(value) >= Overflow)
+		{
+			throw std::out_of_range("Float is too large.");
+		}
+		return (value < 0.0) ? -std::numeric_limits<float>::max() : std::numeric_limits<float>::max();
+	}
+
+	bool NumberParser::IsFloatMidpoint(double value)
+	{
+		// a float keeps 24 of the 53 significant bits of a double, a midpoint has only the highest dropped bit set
+		const std::uint64_t DroppedBits = (1ULL << 29) - 1;
+		const std::uint64_t HalfBit = 1ULL << 28;
+		std::uint64_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return (bits & DroppedBits) == HalfBit;
+	}
+}
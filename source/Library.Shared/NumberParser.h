@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace AnonymousEngine
+{
+	/** Locale independent parsing of the numbers stored in datums and world files.
+	 *
+	 *  The grammar is the one of std::stoi and std::stof in the "C" locale: leading whitespace, an optional sign, and
+	 *  decimal digits with an optional fraction and exponent for floats, or inf and nan. Parsing stops at the first
+	 *  character which is not part of the number. Floats are parsed without any allocation and rounded correctly
+	 *  whenever the significant digits fit in 53 bits, which is every number of up to 15 digits and some of up to 19,
+	 *  and the decimal exponent is at most 22 either way. That covers every value written by std::to_string. Other
+	 *  floats fall back to the standard library in the classic locale
+	 */
+	class NumberParser final
+	{
+	public:
+		NumberParser() = delete;
+
+		/** Parse an integer from the start of a range of characters
+		 *  @param begin The first character to parse
+		 *  @param end One past the last character which may be parsed
+		 *  @param value Set to the parsed value
+		 *  @return One past the last character of the number
+		 *  @exception std::invalid_argument Thrown if the range doesn't start with a number
+		 *  @exception std::out_of_range Thrown if the number doesn't fit in 32 bits
+		 */
+		static const char* Parse(const char* begin, const char* end, std::int32_t& value);
+		/** Parse a float from the start of a range of characters
+		 *  @param begin The first character to parse
+		 *  @param end One past the last character which may be parsed
+		 *  @param value Set to the parsed value
+		 *  @return One past the last character of the number
+		 *  @exception std::invalid_argument Thrown if the range doesn't start with a number
+		 *  @exception std::out_of_range Thrown if the number is too large for a float
+		 */
+		static const char* Parse(const char* begin, const char* end, float& value);
+		/** Parse a list of floats, each one followed by a single separator character such as a comma
+		 *  @param text The text to parse
+		 *  @param values Set to the parsed values
+		 *  @param count The number of values to parse
+		 *  @exception std::invalid_argument Thrown if the text doesn't hold count numbers
+		 *  @exception std::out_of_range Thrown if a number is too large for a float
+		 */
+		static void Parse(const std::string& text, float* values, std::uint32_t count);
+
+		/** Parse an integer at the start of a string, like std::stoi
+		 *  @param text The text to parse
+		 *  @return The parsed value
+		 *  @exception std::invalid_argument Thrown if the text doesn't start with a number
+		 *  @exception std::out_of_range Thrown if the number doesn't fit in 32 bits
+		 */
+		static std::int32_t ToInt(const std::string& text);
+		/** Parse a float at the start of a string, like std::stof
+		 *  @param text The text to parse
+		 *  @return The parsed value
+		 *  @exception std::invalid_argument Thrown if the text doesn't start with a number
+		 *  @exception std::out_of_range Thrown if the number is too large for a float
+		 */
+		static float ToFloat(const std::string& text);
+
+	private:
+		// Skip the whitespace which may precede a number
+		static const char* SkipWhitespace(const char* begin, const char* end);
+		// Check whether a range starts with a lowercase word, ignoring case
+		static bool StartsWith(const char* begin, const char* end, const char* word);
+		// Parse a float the fast path can't handle with the standard library in the classic locale
+		static float ParseSlow(const char* begin, const char* end);
+		// Settle a number the standard library rejected as too large, which may still round down to the largest float
+		static float RoundToLargestFloat(const char* begin, const char* end);
+		// Whether a double lies exactly halfway between two floats, where converting it could round twice
+		static bool IsFloatMidpoint(double value);
+
+		// The exactly representable powers of ten
+		static const double PowersOfTen[23];
+	};
+}
@@ -0,0 +1,264 @@
+#include "ParallelWorldLoader.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include "MemoryMappedFile.h"
+#include "Sector.h"
+#include "World.h"
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		using namespace AnonymousEngine::Containers;
+
+		ParallelWorldLoader::ParallelWorldLoader(Core::JobSystem& jobSystem) :
+			mJobSystem(&jobSystem), mSharedData(), mHelper(), mParseMaster(mSharedData), mSectorCount(0)
+		{
+			mParseMaster.AddHelper(mHelper);
+		}
+
+		World* ParallelWorldLoader::LoadFromFile(const std::string& filename)
+		{
+			MemoryMappedFile file(filename);
+			return Load(file.Data(), file.Size());
+		}
+
+		World* ParallelWorldLoader::Load(const std::string& xml)
+		{
+			return Load(xml.c_str(), xml.size());
+		}
+
+		std::uint32_t ParallelWorldLoader::SectorCount() const
+		{
+			return mSectorCount;
+		}
+
+		World* ParallelWorldLoader::Load(const char* xml, std::uint64_t size)
+		{
+			Range rootTag;
+			Vector<Range> sectorRanges;
+			FindSectors(xml, size, rootTag, sectorRanges);
+
+			// every sector becomes a world document of its own, holding just that sector
+			std::string rootName;
+			if (!sectorRanges.IsEmpty())
+			{
+				rootName.assign(xml + rootTag.mBegin + 1, xml + rootTag.mEnd);
+				rootName.erase(std::find_if(rootName.begin(), rootName.end(), [](char character)
+				{
+					return std::isspace(static_cast<unsigned char>(character)) || character == '/' || character == '>';
+				}), rootName.end());
+			}
+
+			std::string worldXml;
+			worldXml.reserve(static_cast<std::size_t>(size));
+			Vector<SectorLoad> sectors(std::max(sectorRanges.Size(), 1U));
+			std::uint64_t copied = 0;
+			for (const auto& range : sectorRanges)
+			{
+				worldXml.append(xml + copied, xml + range.mBegin);
+				copied = range.mEnd;
+
+				SectorLoad sector = { std::string(), mParseMaster.Clone(), nullptr, nullptr };
+				sector.mXml.append(xml + rootTag.mBegin, xml + rootTag.mEnd).append("<sectors>");
+				sector.mXml.append(xml + range.mBegin, xml + range.mEnd).append("</sectors></").append(rootName).append(">");
+				sectors.PushBack(sector);
+			}
+			worldXml.append(xml + copied, xml + size);
+
+			// the jobs only touch their own sector load, so the vector must not grow from here on. Everything else they
+			// share, the factory registries and the prescribed attribute names, is filled in before the fan out and
+			// only looked up by them
+			Core::JobCounter counter;
+			for (auto& sector : sectors)
+			{
+				SectorLoad* load = &sector;
+				mJobSystem->Run([load]()
+				{
+					try
+					{
+						load->mParseMaster->Parse(load->mXml);
+						load->mWorld = load->mParseMaster->GetSharedData()->As<WorldSharedData>()->ExtractWorld();
+					}
+					catch (...)
+					{
+						load->mError = std::current_exception();
+					}
+				}, &counter);
+			}
+
+			std::exception_ptr error;
+			World* world = nullptr;
+			try
+			{
+				mParseMaster.Parse(worldXml);
+				world = mSharedData.ExtractWorld();
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+			}
+			mJobSystem->Wait(counter);
+
+			// splice the sectors in document order, dropping everything if any part failed
+			for (auto& sector : sectors)
+			{
+				if (error == nullptr)
+				{
+					error = sector.mError;
+				}
+				if (error == nullptr)
+				{
+					world->AdoptSector(static_cast<Sector&>(sector.mWorld->Sectors().Get<Scope>(0)));
+				}
+				delete sector.mWorld;
+				delete sector.mParseMaster;
+			}
+
+			if (error != nullptr)
+			{
+				delete world;
+				std::rethrow_exception(error);
+			}
+			mSectorCount = sectors.Size();
+			return world;
+		}
+
+		void ParallelWorldLoader::FindSectors(const char* xml, std::uint64_t size, Range& rootTag, Vector<Range>& sectors)
+		{
+			static const char* const Skips[][2] = { { "<!--", "-->" }, { "<![CDATA[", "]]>" }, { "<?", "?>" }, { "<!", ">" } };
+
+			rootTag = { 0, 0 };
+			std::uint32_t depth = 0;
+			bool isWorld = false;
+			bool isInSectors = false;
+			bool isInSector = false;
+			std::uint64_t sectorBegin = 0;
+
+			std::uint64_t position = 0;
+			while (position < size)
+			{
+				const char* tag = static_cast<const char*>(std::memchr(xml + position, '<', static_cast<std::size_t>(size - position)));
+				if (tag == nullptr)
+				{
+					break;
+				}
+				std::uint64_t tagBegin = tag - xml;
+
+				// comments, cdata, processing instructions and declarations can't contain sectors
+				bool isSkipped = false;
+				for (const auto& skip : Skips)
+				{
+					std::uint64_t openLength = std::strlen(skip[0]);
+					if (size - tagBegin >= openLength && std::memcmp(tag, skip[0], static_cast<std::size_t>(openLength)) == 0)
+					{
+						const char* end = std::search(tag + openLength, xml + size, skip[1], skip[1] + std::strlen(skip[1]));
+						position = std::min(static_cast<std::uint64_t>(end - xml) + std::strlen(skip[1]), size);
+						isSkipped = true;
+						break;
+					}
+				}
+				if (isSkipped)
+				{
+					continue;
+				}
+
+				bool isEndTag = (size - tagBegin > 1) && (tag[1] == '/');
+				std::uint64_t nameBegin = tagBegin + (isEndTag ? 2 : 1);
+				std::uint64_t nameEnd = nameBegin;
+				while (nameEnd < size && !std::isspace(static_cast<unsigned char>(xml[nameEnd])) && xml[nameEnd] != '/' && xml[nameEnd] != '>')
+				{
+					++nameEnd;
+				}
+
+				// attribute values may contain a '>'
+				std::uint64_t tagEnd = nameEnd;
+				char quote = '\0';
+				while (tagEnd < size && (quote != '\0' || xml[tagEnd] != '>'))
+				{
+					if (quote == '\0' && (xml[tagEnd] == '"' || xml[tagEnd] == '\''))
+					{
+						quote = xml[tagEnd];
+					}
+					else if (xml[tagEnd] == quote)
+					{
+						quote = '\0';
+					}
+					++tagEnd;
+				}
+				if (tagEnd == size)
+				{
+					// a truncated tag is left in place for the parser to report
+					break;
+				}
+				position = ++tagEnd;
+
+				if (isEndTag)
+				{
+					if (depth == 0)
+					{
+						break;
+					}
+					--depth;
+					if (isInSector && depth == 2)
+					{
+						sectors.PushBack({ sectorBegin, tagEnd });
+						isInSector = false;
+					}
+					else if (isInSectors && depth == 1)
+					{
+						isInSectors = false;
+					}
+					continue;
+				}
+
+				const char* name = xml + nameBegin;
+				std::uint64_t nameLength = nameEnd - nameBegin;
+				bool isEmptyElement = (xml[tagEnd - 2] == '/');
+				if (depth == 0)
+				{
+					rootTag = { tagBegin, tagEnd };
+					isWorld = NameEquals(name, nameLength, "world");
+				}
+				else if (depth == 1 && isWorld && NameEquals(name, nameLength, "sectors"))
+				{
+					isInSectors = !isEmptyElement;
+				}
+				else if (depth == 2 && isInSectors && NameEquals(name, nameLength, "sector"))
+				{
+					if (isEmptyElement)
+					{
+						sectors.PushBack({ tagBegin, tagEnd });
+					}
+					else
+					{
+						isInSector = true;
+						sectorBegin = tagBegin;
+					}
+				}
+
+				if (!isEmptyElement)
+				{
+					++depth;
+				}
+			}
+		}
+
+		bool ParallelWorldLoader::NameEquals(const char* name, std::uint64_t length, const char* lowerCaseName)
+		{
+			if (length != std::strlen(lowerCaseName))
+			{
+				return false;
+			}
+			for (std::uint64_t index = 0; index < length; ++index)
+			{
+				if (std::tolower(static_cast<unsigned char>(name[index])) != lowerCaseName[index])
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+}
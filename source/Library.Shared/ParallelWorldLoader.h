@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include "JobSystem.h"
+#include "Vector.h"
+#include "WorldParserHelper.h"
+#include "WorldSharedData.h"
+#include "XmlParseMaster.h"
+
+namespace AnonymousEngine
+{
+	namespace Containers
+	{
+		class World;
+	}
+
+	namespace Parsers
+	{
+		/** Loads world xml files on all the threads of a job system. The file is split at the sector elements under the
+		 *  world's sectors list, every sector is parsed as a job on its own clone of a world parse master and the rest of
+		 *  the world is parsed on the calling thread meanwhile. Once all the jobs are done the sectors are spliced into
+		 *  the world in document order, so the result is the same as parsing the file on a single parse master.
+		 *  The jobs only read the entity and action factory registries, so every factory the file needs has to be
+		 *  registered before a load starts and none may be added or removed until it is done
+		 */
+		class ParallelWorldLoader final
+		{
+		public:
+			/** Initialize a loader
+			 *  @param jobSystem The job system the sectors are parsed on. Should outlive the loader
+			 */
+			explicit ParallelWorldLoader(Core::JobSystem& jobSystem);
+			/** Free up allocated resources
+			 */
+			~ParallelWorldLoader() = default;
+
+			// Delete move and copy semantics
+			ParallelWorldLoader(const ParallelWorldLoader&) = delete;
+			ParallelWorldLoader& operator=(const ParallelWorldLoader&) = delete;
+
+			/** Load a world from an xml file. The file is mapped into memory instead of being read into a string
+			 *  @param filename The name of the world xml file
+			 *  @return The loaded world. The caller takes ownership of it
+			 *  @exception std::runtime_error Thrown if the file can't be read or any part of it fails to parse
+			 */
+			Containers::World* LoadFromFile(const std::string& filename);
+			/** Load a world from an xml string
+			 *  @param xml The world xml
+			 *  @return The loaded world. The caller takes ownership of it
+			 *  @exception std::runtime_error Thrown if any part of the xml fails to parse
+			 */
+			Containers::World* Load(const std::string& xml);
+
+			/** The number of sectors parsed in parallel during the last load
+			 *  @return The sector count of the last loaded world
+			 */
+			std::uint32_t SectorCount() const;
+		private:
+			// A byte range of the xml
+			struct Range
+			{
+				std::uint64_t mBegin;
+				std::uint64_t mEnd;
+			};
+
+			// A sector split out of the xml and the parse master it is parsed on
+			struct SectorLoad
+			{
+				std::string mXml;
+				XmlParseMaster* mParseMaster;
+				Containers::World* mWorld;
+				std::exception_ptr mError;
+			};
+
+			// Parse an xml buffer split at its sectors
+			Containers::World* Load(const char* xml, std::uint64_t size);
+			// Find the start tag of the root element and the byte ranges of the sectors under its sectors list
+			static void FindSectors(const char* xml, std::uint64_t size, Range& rootTag, Vector<Range>& sectors);
+			// Whether a tag name matches a lower case name, ignoring the case of the tag name
+			static bool NameEquals(const char* name, std::uint64_t length, const char* lowerCaseName);
+
+			// The job system the sectors are parsed on
+			Core::JobSystem* mJobSystem;
+			// Shared data, helper and parse master for the world without its sectors. Sectors use clones of them
+			WorldSharedData mSharedData;
+			WorldParserHelper mHelper;
+			XmlParseMaster mParseMaster;
+			// Number of sectors parsed in parallel during the last load
+			std::uint32_t mSectorCount;
+		};
+	}
+}
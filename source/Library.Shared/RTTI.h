@@ -1,41 +1,131 @@
 #pragma once
 
-#include <string>
 #include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "HashedName.h"
 
 #define ANONYMOUS_UNREFERENCED(variable) variable;
 
 namespace AnonymousEngine
 {
+	/** The base of every class with run time type information. Every class knows its depth in the hierarchy and the ids
+	 *  and names of all its ancestors, gathered the first time they are needed, so checking the type of an instance is
+	 *  a single virtual call followed by a walk of that table, instead of one virtual call per level of the hierarchy.
+	 *  Is<T>() and As<T>() know the depth of T at compile time and compare only the ancestor at that depth, which makes
+	 *  them the only constant time checks. An id or a name carries no depth, so checking one walks the ancestors
+	 */
 	class RTTI
 	{
 	public:
+		/** The ids and names of a class and all its ancestors, indexed by their depth in the hierarchy. Depth zero is
+		 *  RTTI itself, which has neither
+		 */
+		struct TypeHierarchy
+		{
+			/** The largest number of levels a hierarchy can have, RTTI included
+			 */
+			static const std::uint32_t MaxDepth = 16U;
+
+			/** The depth of the class
+			 */
+			std::uint32_t mDepth;
+			/** The ids of the ancestors of the class and of the class itself
+			 */
+			std::uint64_t mIds[MaxDepth];
+			/** The hashes of the names of the ancestors of the class and of the class itself
+			 */
+			std::uint32_t mNameHashes[MaxDepth];
+			/** The names of the ancestors of the class and of the class itself
+			 */
+			const char* mNames[MaxDepth];
+		};
+
 		virtual ~RTTI() = default;
 		
 		virtual std::uint64_t TypeIdInstance() const = 0;
+
+		virtual std::string TypeNameInstance() const = 0;
+
+		/** Get the hierarchy of the class of this instance
+		 *  @return The ids and names of the class and all its ancestors
+		 */
+		virtual const TypeHierarchy& TypeHierarchyInstance() const = 0;
 		
-		virtual RTTI* QueryInterface(const std::uint64_t id) const
+		/** Get this instance if it is of the class with the given id or of a class derived from it. This walks the
+		 *  ancestors like Is(id), so prefer As<T>() when the class is known at compile time
+		 *  @param id The id of the class
+		 *  @return This instance, or nullptr if it isn't of the class
+		 */
+		RTTI* QueryInterface(const std::uint64_t id) const
 		{
-			ANONYMOUS_UNREFERENCED(id);
-			return nullptr;
+			return Is(id) ? const_cast<RTTI*>(this) : nullptr;
 		}
 
-		virtual bool Is(std::uint64_t id) const
+		/** Check if this instance is of the class with the given id or of a class derived from it. The id doesn't tell
+		 *  the depth of its class, so this walks the ancestors, at most TypeHierarchy::MaxDepth of them. Use Is<T>(),
+		 *  which is a single compare, whenever the class is known at compile time
+		 *  @param id The id of the class
+		 *  @return True if the instance is of the class
+		 */
+		bool Is(std::uint64_t id) const
 		{
-			ANONYMOUS_UNREFERENCED(id);
+			const TypeHierarchy& hierarchy = TypeHierarchyInstance();
+			for (std::uint32_t depth = hierarchy.mDepth; depth > 0; --depth)
+			{
+				if (hierarchy.mIds[depth] == id)
+				{
+					return true;
+				}
+			}
 			return false;
 		}
 
-		virtual bool Is(const std::string& name) const
+		/** Check if this instance is of the class with the given name or of a class derived from it. The name is hashed
+		 *  once and only compared against the names with the same hash
+		 *  @param name The name of the class
+		 *  @return True if the instance is of the class
+		 */
+		bool Is(const std::string& name) const
+		{
+			return Is(HashedName(name));
+		}
+
+		/** Check if this instance is of the class with the given name or of a class derived from it, without hashing
+		 *  the name, such as a name hashed at compile time
+		 *  @param name The name of the class
+		 *  @return True if the instance is of the class
+		 */
+		bool Is(const HashedName& name) const
 		{
-			ANONYMOUS_UNREFERENCED(name);
+			const TypeHierarchy& hierarchy = TypeHierarchyInstance();
+			for (std::uint32_t depth = hierarchy.mDepth; depth > 0; --depth)
+			{
+				const char* typeName = hierarchy.mNames[depth];
+				if (hierarchy.mNameHashes[depth] == name.Hash() && std::strncmp(typeName, name.Name(), name.Length()) == 0 && typeName[name.Length()] == '\0')
+				{
+					return true;
+				}
+			}
 			return false;
 		}
 
+		/** Check if this instance is of a class or of a class derived from it. The depth of the class is known at
+		 *  compile time, so this is a single compare against the ancestor at that depth
+		 *  @return True if the instance is of the class
+		 */
+		template <typename T>
+		bool Is() const
+		{
+			const TypeHierarchy& hierarchy = TypeHierarchyInstance();
+			return (T::TypeDepth <= hierarchy.mDepth && hierarchy.mIds[T::TypeDepth] == T::TypeIdClass());
+		}
+
 		template <typename T>
 		T* As() const
 		{
-			if (Is(T::TypeIdClass()))
+			if (Is<T>())
 			{
 				return reinterpret_cast<T*>(const_cast<RTTI*>(this));
 			}
@@ -58,36 +148,56 @@ namespace AnonymousEngine
 			ANONYMOUS_UNREFERENCED(str);
 			throw std::runtime_error("Not implemented");
 		}
+
+		/** The depth of RTTI in every hierarchy
+		 */
+		static const std::uint32_t TypeDepth = 0U;
+
+	protected:
+		/** Fill in the part of a hierarchy which belongs to RTTI. Every class fills in its ancestors and then itself
+		 *  @param hierarchy The hierarchy to fill in
+		 */
+		static void FillTypeHierarchy(TypeHierarchy& hierarchy)
+		{
+			hierarchy.mDepth = TypeDepth;
+			hierarchy.mIds[TypeDepth] = 0U;
+			hierarchy.mNameHashes[TypeDepth] = 0U;
+			hierarchy.mNames[TypeDepth] = "";
+		}
 	};
 
 #define RTTI_DECLARATIONS(Type, ParentType)																	 \
 		public:                                                                                              \
 			typedef ParentType Parent;                                                                       \
+			static const std::uint32_t TypeDepth = Parent::TypeDepth + 1U;                                   \
 			static std::string TypeName() { return std::string(#Type); }                                     \
 			static std::uint64_t TypeIdClass() { return sRunTimeTypeId; }                                    \
-			virtual std::uint64_t TypeIdInstance() const override { return Type::TypeIdClass(); }            \
-			virtual AnonymousEngine::RTTI* QueryInterface(const std::uint64_t id) const override             \
-            {                                                                                                \
-                if (id == sRunTimeTypeId)                                                                    \
-					{ return (RTTI*)this; }                                                                  \
-                else                                                                                         \
-					{ return Parent::QueryInterface(id); }                                                   \
-            }                                                                                                \
-			virtual bool Is(std::uint64_t id) const override                                                 \
+			static const AnonymousEngine::RTTI::TypeHierarchy& TypeHierarchyClass()                          \
 			{                                                                                                \
-				if (id == sRunTimeTypeId)                                                                    \
-					{ return true; }                                                                         \
-				else                                                                                         \
-					{ return Parent::Is(id); }                                                               \
+				static const AnonymousEngine::RTTI::TypeHierarchy hierarchy = MakeTypeHierarchy();           \
+				return hierarchy;                                                                            \
 			}                                                                                                \
-			virtual bool Is(const std::string& name) const override                                          \
+			virtual std::uint64_t TypeIdInstance() const override { return Type::TypeIdClass(); }            \
+			virtual std::string TypeNameInstance() const override { return Type::TypeName(); }               \
+			virtual const AnonymousEngine::RTTI::TypeHierarchy& TypeHierarchyInstance() const override       \
+				{ return Type::TypeHierarchyClass(); }                                                       \
+		protected:                                                                                           \
+			static void FillTypeHierarchy(AnonymousEngine::RTTI::TypeHierarchy& hierarchy)                   \
 			{                                                                                                \
-				if (name == TypeName())                                                                      \
-					{ return true; }                                                                         \
-				else                                                                                         \
-					{ return Parent::Is(name); }                                                             \
+				static_assert(TypeDepth < AnonymousEngine::RTTI::TypeHierarchy::MaxDepth, "Hierarchy too deep"); \
+				Parent::FillTypeHierarchy(hierarchy);                                                        \
+				hierarchy.mDepth = TypeDepth;                                                                \
+				hierarchy.mIds[TypeDepth] = reinterpret_cast<std::uint64_t>(&sRunTimeTypeId);               \
+				hierarchy.mNameHashes[TypeDepth] = AnonymousEngine::HashedName(#Type).Hash();                \
+				hierarchy.mNames[TypeDepth] = #Type;                                                         \
 			}                                                                                                \
 			private:                                                                                         \
+				static AnonymousEngine::RTTI::TypeHierarchy MakeTypeHierarchy()                              \
+				{                                                                                            \
+					AnonymousEngine::RTTI::TypeHierarchy hierarchy;                                          \
+					FillTypeHierarchy(hierarchy);                                                            \
+					return hierarchy;                                                                        \
+				}                                                                                            \
 				static std::uint64_t sRunTimeTypeId;
 
 #define RTTI_DEFINITIONS(Type) std::uint64_t Type::sRunTimeTypeId = reinterpret_cast<std::uint64_t>(&Type::sRunTimeTypeId);
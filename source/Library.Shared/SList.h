@@ -1,12 +1,17 @@
 #pragma once
 
 #include <cstdint>
+#include <new>
+#include <utility>
+#include "NodePool.h"
 
 namespace AnonymousEngine
 {
-	/** A single linked list container
+	/** A single linked list container. Nodes come from the node allocator, which by default is a pool owned by the list
+	 *  so removing and inserting items reuses nodes instead of going back to the heap. An allocator provides
+	 *  Allocate(size), Free(block) and Release(), which is called when the list has been cleared
 	*/
-	template <typename T>
+	template <typename T, typename TAllocator = PooledNodeAllocator>
 	class SList
 	{
 		// Node structure representing each item in the list
@@ -75,15 +80,16 @@ namespace AnonymousEngine
 			Iterator end() const;
 		private:
 			Node* mNode;
-			const SList<T>* mOwner;
+			const SList* mOwner;
 
-			Iterator(Node* node, const SList<T>* owner);
-			friend SList<T>;
+			Iterator(Node* node, const SList* owner);
+			friend SList;
 		};
 
 		/** Constructs a new single linked list
+		 *  @param allocator The allocator to take the nodes of the list from
 		 */
-		explicit SList();
+		explicit SList(const TAllocator& allocator = TAllocator());
 
 		/** Copy constructor to construct a linked list copy of another list
 		 *	@param rhs The other list to create copy from
@@ -190,12 +196,31 @@ namespace AnonymousEngine
 		*/
 		bool Remove(const T& data);
 
+		/** Removes the item an iterator points to
+		*   @param it The iterator to the item to remove
+		*   @return A boolean indicating whether an element was removed or not
+		*   @exception std::invalid_argument Thrown if the iterator is not an iterator to the current list
+		*/
+		bool Remove(const Iterator& it);
+
+		/** Get the allocator the nodes of the list come from, such as to point a SharedNodeAllocator at the new place
+		*   of its pool once the owner of the pool has moved. The nodes already in the list have to stay valid with it
+		*   @return A reference to the allocator of the list
+		*/
+		TAllocator& Allocator();
+
 	private:
 		// Private method to create a copy of another list
-		void Copy(const SList<T>& rhs);
+		void Copy(const SList& rhs);
 
 		// Private method to move the data from another list
-		void Move(SList<T>& rhs);
+		void Move(SList& rhs);
+
+		// Allocate a node from the allocator and construct it
+		Node* CreateNode(Node* next, const T& data);
+
+		// Destruct a node and return it to the allocator
+		void DestroyNode(Node* node);
 
 		// Pointer to the first element in the list
 		Node* mFront;
@@ -203,6 +228,8 @@ namespace AnonymousEngine
 		Node* mBack;
 		// Number of elements in the list
 		std::uint32_t mSize;
+		// The allocator the nodes come from
+		TAllocator mAllocator;
 	};
 }
 
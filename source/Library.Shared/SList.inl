@@ -2,25 +2,25 @@
 namespace AnonymousEngine
 {
 #pragma region NodeMethods
-	template<typename T>
-	SList<T>::Node::Node(Node* next, const T& data) : mNext(next), mData(data)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::Node::Node(Node* next, const T& data) : mNext(next), mData(data)
 	{
 	}
 #pragma endregion 
 
 #pragma region IteratorMethods
-	template<typename T>
-	SList<T>::Iterator::Iterator() : mNode(nullptr), mOwner(nullptr)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::Iterator::Iterator() : mNode(nullptr), mOwner(nullptr)
 	{
 	}
 
-	template<typename T>
-	SList<T>::Iterator::Iterator(Node* node, const SList<T>* owner) : mNode(node), mOwner(owner)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::Iterator::Iterator(Node* node, const SList<T, TAllocator>* owner) : mNode(node), mOwner(owner)
 	{
 	}
 	
-	template<typename T>
-	typename SList<T>::Iterator& SList<T>::Iterator::operator++()
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator& SList<T, TAllocator>::Iterator::operator++()
 	{
 		if (mNode != nullptr)
 		{
@@ -33,8 +33,8 @@ namespace AnonymousEngine
 		}
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::Iterator::operator++(int)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Iterator::operator++(int)
 	{
 		if (mNode != nullptr)
 		{
@@ -48,8 +48,8 @@ namespace AnonymousEngine
 		}
 	}
 
-	template<typename T>
-	T& SList<T>::Iterator::operator*() const
+	template <typename T, typename TAllocator>
+	T& SList<T, TAllocator>::Iterator::operator*() const
 	{
 		if (mNode == nullptr)
 		{
@@ -58,39 +58,39 @@ namespace AnonymousEngine
 		return mNode->mData;
 	}
 
-	template<typename T>
-	bool SList<T>::Iterator::operator==(const Iterator& rhs) const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Iterator::operator==(const Iterator& rhs) const
 	{
 		return (mOwner == rhs.mOwner && mNode == rhs.mNode);
 	}
 
-	template<typename T>
-	bool SList<T>::Iterator::operator!=(const Iterator& rhs) const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		return !(*this == rhs);
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::Iterator::end() const
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Iterator::end() const
 	{
 		return (mOwner != nullptr) ? mOwner->end() : Iterator();
 	}
 #pragma endregion 
 
 #pragma region SListMethods
-	template<typename T>
-	SList<T>::SList() : mFront(nullptr), mBack(nullptr), mSize(0)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::SList(const TAllocator& allocator) : mFront(nullptr), mBack(nullptr), mSize(0), mAllocator(allocator)
 	{
 	}
 
-	template<typename T>
-	SList<T>::SList(const SList& rhs) : SList()
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::SList(const SList& rhs) : SList(rhs.mAllocator)
 	{
 		Copy(rhs);
 	}
 
-	template<typename T>
-	SList<T>& SList<T>::operator=(const SList& rhs)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>& SList<T, TAllocator>::operator=(const SList& rhs)
 	{
 		if (this != &rhs)
 		{
@@ -100,27 +100,28 @@ namespace AnonymousEngine
 		return *this;
 	}
 
-	template<typename T>
-	SList<T>::SList(SList&& rhs) noexcept
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::SList(SList&& rhs) noexcept : mAllocator(std::move(rhs.mAllocator))
 	{
 		Move(rhs);
 	}
 
-	template <typename T>
-	SList<T>& SList<T>::operator=(SList&& rhs) noexcept
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>& SList<T, TAllocator>::operator=(SList&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
 			Clear();
+			mAllocator = std::move(rhs.mAllocator);
 			Move(rhs);
 		}
 		return *this;
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::PushFront(const T& data)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushFront(const T& data)
 	{
-		Node* node = new Node(mFront, data);
+		Node* node = CreateNode(mFront, data);
 		if (mFront == nullptr)
 		{
 			mBack = node;
@@ -130,8 +131,8 @@ namespace AnonymousEngine
 		return begin();
 	}
 
-	template<typename T>
-	void SList<T>::PopFront()
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::PopFront()
 	{
 		if (mSize > 0)
 		{
@@ -142,14 +143,14 @@ namespace AnonymousEngine
 			{
 				mBack = nullptr;
 			}
-			delete node;
+			DestroyNode(node);
 		}
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::PushBack(const T& data)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushBack(const T& data)
 	{
-		Node* node = new Node(nullptr, data);
+		Node* node = CreateNode(nullptr, data);
 		if (mBack != nullptr)
 		{
 			mBack->mNext = node;
@@ -163,8 +164,8 @@ namespace AnonymousEngine
 		return Iterator(node, this);
 	}
 
-	template<typename T>
-	T& SList<T>::Front()
+	template <typename T, typename TAllocator>
+	T& SList<T, TAllocator>::Front()
 	{
 		if (mFront == nullptr)
 		{
@@ -173,14 +174,14 @@ namespace AnonymousEngine
 		return mFront->mData;
 	}
 
-	template<typename T>
-	const T& SList<T>::Front() const
+	template <typename T, typename TAllocator>
+	const T& SList<T, TAllocator>::Front() const
 	{
 		return const_cast<const T&>(const_cast<SList*>(this)->Front());
 	}
 
-	template<typename T>
-	T& SList<T>::Back()
+	template <typename T, typename TAllocator>
+	T& SList<T, TAllocator>::Back()
 	{
 		if (mBack == nullptr)
 		{
@@ -189,53 +190,54 @@ namespace AnonymousEngine
 		return mBack->mData;
 	}
 
-	template<typename T>
-	const T& SList<T>::Back() const
+	template <typename T, typename TAllocator>
+	const T& SList<T, TAllocator>::Back() const
 	{
 		return const_cast<const T&>(const_cast<SList*>(this)->Back());
 	}
 
-	template<typename T>
-	std::uint32_t SList<T>::Size() const
+	template <typename T, typename TAllocator>
+	std::uint32_t SList<T, TAllocator>::Size() const
 	{
 		return mSize;
 	}
 
-	template<typename T>
-	bool SList<T>::IsEmpty() const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::IsEmpty() const
 	{
 		return (mFront == nullptr);
 	}
 
-	template<typename T>
-	void SList<T>::Clear()
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::Clear()
 	{
 		while(mSize > 0)
 		{
 			PopFront();
 		}
+		mAllocator.Release();
 	}
 
-	template<typename T>
-	SList<T>::~SList()
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::~SList()
 	{
 		Clear();
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::begin() const
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::begin() const
 	{
 		return Iterator(mFront, this);
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::end() const
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::end() const
 	{
 		return Iterator(nullptr, this);
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::Find(const T& value) const
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Find(const T& value) const
 	{
 		for(Iterator it = begin(); it != end(); ++it)
 		{
@@ -247,8 +249,8 @@ namespace AnonymousEngine
 		return end();
 	}
 
-	template<typename T>
-	typename SList<T>::Iterator SList<T>::InsertAfter(const T& data, const typename SList<T>::Iterator& it)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::InsertAfter(const T& data, const typename SList<T, TAllocator>::Iterator& it)
 	{
 		if (it.mOwner != this)
 		{
@@ -260,7 +262,7 @@ namespace AnonymousEngine
 			return PushBack(data);
 		}
 
-		Node* node = new Node(it.mNode->mNext, data);
+		Node* node = CreateNode(it.mNode->mNext, data);
 		if (it.mNode == mBack)
 		{
 			mBack = node;
@@ -270,8 +272,8 @@ namespace AnonymousEngine
 		return Iterator(node, this);
 	}
 
-	template<typename T>
-	bool SList<T>::Remove(const T& data)
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Remove(const T& data)
 	{
 		if (mSize == 0)
 		{
@@ -294,7 +296,7 @@ namespace AnonymousEngine
 				{
 					mBack = previous.mNode;
 				}
-				delete it.mNode;
+				DestroyNode(it.mNode);
 				mSize--;
 				return true;
 			}
@@ -303,9 +305,51 @@ namespace AnonymousEngine
 		return false;
 	}
 
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Remove(const Iterator& it)
+	{
+		if (it.mOwner != this)
+		{
+			throw std::invalid_argument("Iterator is not an iterator to the current list");
+		}
+
+		if (it.mNode == nullptr)
+		{
+			return false;
+		}
+
+		if (it.mNode == mFront)
+		{
+			PopFront();
+			return true;
+		}
+
+		for (Node* previous = mFront; previous->mNext != nullptr; previous = previous->mNext)
+		{
+			if (previous->mNext == it.mNode)
+			{
+				previous->mNext = it.mNode->mNext;
+				if (it.mNode == mBack)
+				{
+					mBack = previous;
+				}
+				DestroyNode(it.mNode);
+				mSize--;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template <typename T, typename TAllocator>
+	TAllocator& SList<T, TAllocator>::Allocator()
+	{
+		return mAllocator;
+	}
+
 	// This method is used by copy constructor and copy assignment operator to copy values from another list
-	template<typename T>
-	void SList<T>::Copy(const SList<T>& rhs)
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::Copy(const SList<T, TAllocator>& rhs)
 	{
 		for (Node* node = rhs.mFront; node != nullptr; node = node->mNext)
 		{
@@ -314,8 +358,8 @@ namespace AnonymousEngine
 	}
 
 	// This method is used by move constructor and move assignment operator to move values from another list
-	template<typename T>
-	void SList<T>::Move(SList<T>& rhs)
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::Move(SList<T, TAllocator>& rhs)
 	{
 		mFront = rhs.mFront;
 		mBack = rhs.mBack;
@@ -324,5 +368,27 @@ namespace AnonymousEngine
 		rhs.mSize = 0;
 	}
 
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Node* SList<T, TAllocator>::CreateNode(Node* next, const T& data)
+	{
+		void* block = mAllocator.Allocate(sizeof(Node));
+		try
+		{
+			return new(block) Node(next, data);
+		}
+		catch (...)
+		{
+			mAllocator.Free(block);
+			throw;
+		}
+	}
+
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		mAllocator.Free(node);
+	}
+
 #pragma endregion 
 }
@@ -1,10 +1,13 @@
 #include "Scope.h"
+#include "ScopeTextWriter.h"
 
 namespace AnonymousEngine
 {
 	RTTI_DEFINITIONS(Scope)
 
-	Scope::Scope() : mParent(nullptr), mParentDatumIndex(0)
+	std::atomic<std::uint64_t> Scope::sNextGeneration(1U);
+
+	Scope::Scope() : mParent(nullptr), mParentDatumIndex(0), mGeneration(sNextGeneration++)
 	{
 	}
 
@@ -54,7 +57,33 @@ namespace AnonymousEngine
 		return const_cast<Scope*>(this)->Find(name);
 	}
 
+	Datum* Scope::Find(const HashedName& name)
+	{
+		auto it = mDatumMap.Find(name, name.Hash());
+		if (it != mDatumMap.end())
+		{
+			return &it->second;
+		}
+		return nullptr;
+	}
+
+	const Datum* Scope::Find(const HashedName& name) const
+	{
+		return const_cast<Scope*>(this)->Find(name);
+	}
+
 	Datum* Scope::Search(const std::string& name, Scope** foundScope)
+	{
+		// hash the name once for every scope up the chain
+		return Search(HashedName(name), foundScope);
+	}
+
+	const Datum* Scope::Search(const std::string& name, Scope** foundScope) const
+	{
+		return const_cast<Scope*>(this)->Search(name, foundScope);
+	}
+
+	Datum* Scope::Search(const HashedName& name, Scope** foundScope)
 	{
 		Scope* scopeToSearch = this;
 		while (scopeToSearch != nullptr)
@@ -73,7 +102,7 @@ namespace AnonymousEngine
 		return nullptr;
 	}
 
-	const Datum* Scope::Search(const std::string& name, Scope** foundScope) const
+	const Datum* Scope::Search(const HashedName& name, Scope** foundScope) const
 	{
 		return const_cast<Scope*>(this)->Search(name, foundScope);
 	}
@@ -136,6 +165,22 @@ namespace AnonymousEngine
 		return mDatumMap[name];
 	}
 
+	Datum& Scope::operator[](const HashedName& name)
+	{
+		Datum* datum = Find(name);
+		return (datum != nullptr) ? *datum : Append(name.ToString());
+	}
+
+	const Datum& Scope::operator[](const HashedName& name) const
+	{
+		const Datum* datum = Find(name);
+		if (datum == nullptr)
+		{
+			throw std::invalid_argument("Key not found");
+		}
+		return *datum;
+	}
+
 	Datum& Scope::operator[](const std::uint32_t index)
 	{
 		return mOrderVector[index]->second;
@@ -146,6 +191,16 @@ namespace AnonymousEngine
 		return mOrderVector[index]->second;
 	}
 
+	std::uint32_t Scope::Size() const
+	{
+		return mOrderVector.Size();
+	}
+
+	const std::string& Scope::GetKey(const std::uint32_t index) const
+	{
+		return mOrderVector[index]->first;
+	}
+
 	bool Scope::operator==(const Scope& rhs) const
 	{
 		return (mDatumMap == rhs.mDatumMap);
@@ -183,42 +238,8 @@ namespace AnonymousEngine
 
 	std::string Scope::ToString() const
 	{
-		std::string output = "{";
-		std::uint32_t attributeIndex = 0;
-		for (const auto& entry : mOrderVector)
-		{
-			if (entry->first == "this" || entry->second.Size() == 0)
-			{
-				continue;
-			}
-
-			std::uint32_t entrySize = entry->second.Size();
-			if (attributeIndex > 0)
-			{
-				output.append(", ");
-			}
-			output.append("\"").append(entry->first).append("\"").append((entrySize > 1) ? ": [" : ": ");
-			for (std::uint32_t i = 0; i < entry->second.Size(); ++i)
-			{
-				if (entry->second.Type() != Datum::DatumType::Scope)
-				{
-					output.append((i == 0) ? "\"" : ", \"");
-				}
-				else if (i > 0)
-				{
-					output.append(", ");
-				}
-				output.append(entry->second.ToString(i));
-				if (entry->second.Type() != Datum::DatumType::Scope)
-				{
-					output.append("\"");
-				}
-			}
-			output.append((entrySize > 1) ? "]" : "");
-			++attributeIndex;
-		}
-		output.append("}");
-		return output;
+		ScopeTextWriter writer;
+		return writer.Write(*this);
 	}
 
 	void Scope::FromString(const std::string&)
@@ -229,7 +250,7 @@ namespace AnonymousEngine
 	void Scope::Clear()
 	{
 		Orphan();
-		for (const auto& pairPtr : mOrderVector)
+		for (const auto& pairPtr : mOrderVector.Items())
 		{
 			Datum& datum = pairPtr->second;
 			if (datum.Type() == Datum::DatumType::Scope)
@@ -244,11 +265,17 @@ namespace AnonymousEngine
 		}
 		mOrderVector.Clear();
 		mDatumMap.Clear();
+		mGeneration = sNextGeneration++;
+	}
+
+	std::uint64_t Scope::Generation() const
+	{
+		return mGeneration;
 	}
 
 	void Scope::Copy(const Scope& rhs)
 	{
-		for (const auto pairPtr : rhs.mOrderVector)
+		for (const auto pairPtr : rhs.mOrderVector.Items())
 		{
 			const std::string& key = pairPtr->first;
 			const Datum& rhsDatum = pairPtr->second;
@@ -286,7 +313,7 @@ namespace AnonymousEngine
 			(*mParent)[mParentKey].Set(*this, mParentDatumIndex);
 		}
 
-		for (auto pairPtr : mOrderVector)
+		for (auto pairPtr : mOrderVector.Items())
 		{
 			Datum& datum = pairPtr->second;
 			if (datum.Type() == Datum::DatumType::Scope)
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include "Datum.h"
 #include "HashMap.h"
+#include "HashedName.h"
 #include "RTTI.h"
 #include "Vector.h"
 
@@ -50,6 +53,18 @@ namespace AnonymousEngine
 		 */
 		const Datum* Find(const std::string& name) const;
 
+		/** Find a given key in the current scope without hashing it, such as a key hashed at compile time
+		 *  @param name The key to search for in the current scope
+		 *  @return Address of the datum at that key. Returns nullptr if the key is not found
+		 */
+		Datum* Find(const HashedName& name);
+
+		/** Find a given key in the current scope without hashing it. Constant version
+		 *  @param name The key to search for in the current scope
+		 *  @return Address of the datum at that key. Returns nullptr if the key is not found
+		 */
+		const Datum* Find(const HashedName& name) const;
+
 		/** Search for a key in the current scope. If not found in the current scope go up the
 		 *  chain until The key is found
 		 *  @param name The key to search for
@@ -64,6 +79,18 @@ namespace AnonymousEngine
 		 */
 		const Datum* Search(const std::string& name, Scope** foundScope = nullptr) const;
 
+		/** Search for a key in the current scope and up the chain of parents, hashing it only once
+		 *  @param name The key to search for
+		 *  @foundScope Output parameter to store the address of the scope in which the key was found.
+		 */
+		Datum* Search(const HashedName& name, Scope** foundScope = nullptr);
+
+		/** Search for a key in the current scope and up the chain of parents, hashing it only once. Constant version
+		 *  @param name The key to search for
+		 *  @foundScope Output parameter to store the address of the scope in which the key was found.
+		 */
+		const Datum* Search(const HashedName& name, Scope** foundScope = nullptr) const;
+
 		/** Create a new Datum in the current scope at the given key. If the key exists already,
 		 *		return the address of the existing Datum
 		 *	DO NOT use this method for appending a scope. Use AppendScope instead.
@@ -110,6 +137,20 @@ namespace AnonymousEngine
 		 */
 		const Datum& operator[](const std::string& name) const;
 
+		/** Get a reference to the Datum at the given key in the current scope, creating it if it doesn't exist.
+		 *  The key is only hashed again if it has to be added
+		 *  @param name The key to search for
+		 *  @return The address of the datum which was found / created
+		 */
+		Datum& operator[](const HashedName& name);
+
+		/** Get a reference to the Datum at the given key in the current scope without hashing the key.
+		 *  Throws an exception if key was not found in the scope
+		 *  @param name The key to search for
+		 *  @return The address of the datum which was found
+		 */
+		const Datum& operator[](const HashedName& name) const;
+
 		/** Get the address of the Datum at the given index in the current scope.
 		 *  Works similar to Append, i.e. creates new Datum if no datum exists with the given key
 		 *  @param index The index to search for
@@ -124,6 +165,18 @@ namespace AnonymousEngine
 		 */
 		const Datum& operator[](const std::uint32_t index) const;
 
+		/** Get the number of datums in the current scope
+		 *  @return The number of keys in the scope
+		 */
+		std::uint32_t Size() const;
+
+		/** Get the key of the Datum at the given index in the current scope. Indices follow the order of insertion
+		 *  @param index The index of the datum
+		 *  @return The key against which the datum is stored
+		 *  @exception std::out_of_range Thrown if the index is not less than the size of the scope
+		 */
+		const std::string& GetKey(const std::uint32_t index) const;
+
 		/** Check if two scopes are logically equivalent
 		 *  @param rhs The scope to compare the current scope to
 		 *  @return Boolean indicating whether the two scopes are equal or not
@@ -165,6 +218,13 @@ namespace AnonymousEngine
 		*/
 		void Orphan();
 
+		/** Get the generation of this scope. Every scope gets a new one when it is created and whenever it is cleared
+		 *  or assigned to, and a generation is never handed out twice, so unlike its address it identifies the scope
+		 *  even after another one takes the place of a destroyed one
+		 *  @return The generation of this scope
+		 */
+		std::uint64_t Generation() const;
+
 	protected:
 		/** The child objects data map
 		 */
@@ -180,6 +240,11 @@ namespace AnonymousEngine
 		std::string mParentKey;
 		// Stores the index of this scope within the parent scope's datum where this is stored
 		std::uint32_t mParentDatumIndex;
+		// The generation of this scope
+		std::uint64_t mGeneration;
+
+		// The generation handed to the next scope which is created or cleared
+		static std::atomic<std::uint64_t> sNextGeneration;
 
 		// Copies another scope to this scope. Used by copy constructor and copy assignment operator
 		void Copy(const Scope& rhs);
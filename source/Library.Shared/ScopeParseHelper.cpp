@@ -1,4 +1,5 @@
 #include "ScopeParseHelper.h"
+#include "NumberParser.h"
 #include "ScopeSharedData.h"
 
 namespace AnonymousEngine
@@ -45,9 +46,26 @@ namespace AnonymousEngine
 			return helper;
 		}
 
+		Vector<std::string> ScopeParseHelper::Tags() const
+		{
+			Vector<std::string> tags(StartElementHandlers.Size());
+			for (const auto& handler : StartElementHandlers)
+			{
+				tags.PushBack(handler.first);
+			}
+			return tags;
+		}
+
+		bool ScopeParseHelper::IsSharedDataSupported(const SharedData& sharedData) const
+		{
+			return sharedData.Is<ScopeSharedData>();
+		}
+
 		bool ScopeParseHelper::StartElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes)
 		{
-			if (!sharedData.Is(ScopeSharedData::TypeIdClass()) || !StartElementHandlers.ContainsKey(name))
+			ScopeSharedData* data = sharedData.As<ScopeSharedData>();
+			auto it = StartElementHandlers.Find(name);
+			if (data == nullptr || it == StartElementHandlers.end())
 			{
 				return false;
 			}
@@ -57,19 +75,19 @@ namespace AnonymousEngine
 				throw std::runtime_error("Invalid root tag");
 			}
 
-			ScopeSharedData& data = *(sharedData.As<ScopeSharedData>());
-			StartElementHandlers[name](*this, data, attributes);
+			it->second(*this, *data, attributes);
 			return true;
 		}
 
 		bool ScopeParseHelper::EndElementHandler(SharedData& sharedData, const std::string& name)
 		{
-			if (!sharedData.Is(ScopeSharedData::TypeIdClass()) || !EndElementHandlers.ContainsKey(name))
+			ScopeSharedData* data = sharedData.As<ScopeSharedData>();
+			auto it = EndElementHandlers.Find(name);
+			if (data == nullptr || it == EndElementHandlers.end())
 			{
 				return false;
 			}
-			ScopeSharedData& data = *(sharedData.As<ScopeSharedData>());
-			EndElementHandlers[name](*this, data);
+			it->second(*this, *data);
 			return true;
 		}
 
@@ -79,7 +97,7 @@ namespace AnonymousEngine
 			Datum& datum = sharedData.mScope->Append(attributes[NAME]);
 			if (attributes.ContainsKey(VALUE))
 			{
-				datum.PushBack(std::stoi(attributes[VALUE]));
+				datum.PushBack(NumberParser::ToInt(attributes[VALUE]));
 			}
 		}
 
@@ -89,7 +107,7 @@ namespace AnonymousEngine
 			Datum& datum = sharedData.mScope->Append(attributes[NAME]);
 			if (attributes.ContainsKey(VALUE))
 			{
-				datum.PushBack(std::stof(attributes[VALUE]));
+				datum.PushBack(NumberParser::ToFloat(attributes[VALUE]));
 			}
 		}
 
@@ -108,22 +126,17 @@ namespace AnonymousEngine
 			ValidateRequiredAttributes(attributes);
 			if (attributes.ContainsKey(VECTOR_X) && attributes.ContainsKey(VECTOR_Y) && attributes.ContainsKey(VECTOR_Z) && attributes.ContainsKey(VECTOR_W))
 			{
-				Datum datum;
-				datum.SetType(Datum::DatumType::Vector);
-				std::string toParse = attributes[VECTOR_X];
-				toParse.append(",");
-				toParse.append(attributes[VECTOR_Y]).append(",");
-				toParse.append(attributes[VECTOR_Z]).append(",");
-				toParse.append(attributes[VECTOR_W]);
-				datum.Resize(1U);
-				datum.SetFromString(toParse);
+				glm::vec4 vector(NumberParser::ToFloat(attributes[VECTOR_X]), NumberParser::ToFloat(attributes[VECTOR_Y]),
+					NumberParser::ToFloat(attributes[VECTOR_Z]), NumberParser::ToFloat(attributes[VECTOR_W]));
 
 				if (helper.mMatrixName.empty())
 				{
-					sharedData.mScope->Append(attributes[NAME]).PushBack(datum.Get<glm::vec4>());
+					sharedData.mScope->Append(attributes[NAME]).PushBack(vector);
 				}
 				else
 				{
+					Datum datum;
+					datum = vector;
 					helper.mMatrixVectors.PushBack(datum);
 				}
 			}
@@ -0,0 +1,278 @@
+#include "ScopeTextReader.h"
+#include <stdexcept>
+#include "NumberParser.h"
+
+namespace AnonymousEngine
+{
+	ScopeTextReader::ScopeTextReader() :
+		mBegin(nullptr), mPosition(nullptr), mEnd(nullptr), mValues()
+	{
+	}
+
+	void ScopeTextReader::Read(const std::string& text, Scope& scope)
+	{
+		mBegin = text.c_str();
+		mPosition = mBegin;
+		mEnd = mBegin + text.size();
+		ReadScope(scope);
+		SkipWhitespace();
+		if (mPosition != mEnd)
+		{
+			Fail("Unexpected text after the scope.");
+		}
+	}
+
+	void ScopeTextReader::ReadScope(Scope& scope)
+	{
+		Expect('{');
+		if (Peek() == '}')
+		{
+			++mPosition;
+			return;
+		}
+
+		while (true)
+		{
+			ReadMember(scope);
+			char next = Peek();
+			if (next == '}')
+			{
+				++mPosition;
+				break;
+			}
+			if (next != ',')
+			{
+				Fail("Expected a comma or the end of the scope.");
+			}
+			++mPosition;
+		}
+	}
+
+	void ScopeTextReader::ReadMember(Scope& scope)
+	{
+		std::string key;
+		ReadString(key);
+		Expect(':');
+		bool isArray = (Peek() == '[');
+		if (isArray)
+		{
+			++mPosition;
+		}
+
+		Datum& datum = scope.Append(key);
+		bool isScope = (Peek() == '{');
+		std::uint32_t count = 0;
+		while (true)
+		{
+			if (isScope)
+			{
+				ReadScopeValue(scope, key, datum, count);
+			}
+			else
+			{
+				if (count == mValues.Size())
+				{
+					mValues.PushBack(std::string());
+				}
+				ReadString(mValues[count]);
+			}
+			++count;
+
+			if (!isArray || Peek() != ',')
+			{
+				break;
+			}
+			++mPosition;
+		}
+		if (isArray)
+		{
+			Expect(']');
+		}
+
+		if (!isScope)
+		{
+			StoreValues(datum, key, count);
+		}
+	}
+
+	void ScopeTextReader::ReadScopeValue(Scope& scope, const std::string& key, Datum& datum, std::uint32_t index)
+	{
+		if (datum.Type() != Datum::DatumType::Unknown && datum.Type() != Datum::DatumType::Scope)
+		{
+			Fail("A scope doesn't match the type of its datum.");
+		}
+
+		// nested scopes created by a constructor are filled in place
+		if (index < datum.Size())
+		{
+			ReadScope(datum.Get<Scope>(index));
+		}
+		else
+		{
+			ReadScope(scope.AppendScope(key));
+		}
+	}
+
+	void ScopeTextReader::ReadString(std::string& value)
+	{
+		Expect('"');
+		value.clear();
+		while (true)
+		{
+			const char* runEnd = mPosition;
+			while (runEnd != mEnd && *runEnd != '"' && *runEnd != '\\')
+			{
+				++runEnd;
+			}
+			value.append(mPosition, runEnd);
+			mPosition = runEnd;
+			if (mPosition == mEnd || (mPosition + 1 == mEnd && *mPosition == '\\'))
+			{
+				Fail("Unterminated string.");
+			}
+			if (*mPosition == '"')
+			{
+				++mPosition;
+				return;
+			}
+			value.push_back(mPosition[1]);
+			mPosition += 2;
+		}
+	}
+
+	void ScopeTextReader::StoreValues(Datum& datum, const std::string& key, std::uint32_t count)
+	{
+		if (datum.Type() == Datum::DatumType::Scope)
+		{
+			Fail("A string doesn't match the type of its datum.");
+		}
+		if (datum.Type() == Datum::DatumType::RTTI)
+		{
+			// pointers can't be restored from text
+			return;
+		}
+		if (datum.Type() == Datum::DatumType::Unknown)
+		{
+			datum.SetType(InferType(mValues[0]));
+		}
+
+		// prescribed attributes point at members and can't be resized
+		if (!datum.IsExternal())
+		{
+			datum.Resize(count);
+		}
+		else if (datum.Size() != count)
+		{
+			throw std::runtime_error(std::string("Scope text size doesn't match the prescribed attribute. key = ").append(key));
+		}
+
+		try
+		{
+			for (std::uint32_t index = 0; index < count; ++index)
+			{
+				if (datum.Type() == Datum::DatumType::String)
+				{
+					datum.Set(mValues[index], index);
+				}
+				else
+				{
+					datum.SetFromString(mValues[index], index);
+				}
+			}
+		}
+		catch (const std::logic_error&)
+		{
+			throw std::runtime_error(std::string("Scope text value doesn't parse as the type of its datum. key = ").append(key));
+		}
+	}
+
+	void ScopeTextReader::SkipWhitespace()
+	{
+		while (mPosition != mEnd && (*mPosition == ' ' || (*mPosition >= '\t' && *mPosition <= '\r')))
+		{
+			++mPosition;
+		}
+	}
+
+	void ScopeTextReader::Expect(char character)
+	{
+		if (Peek() != character)
+		{
+			Fail((character == '"') ? "Expected a string." : "Unexpected character.");
+		}
+		++mPosition;
+	}
+
+	char ScopeTextReader::Peek()
+	{
+		SkipWhitespace();
+		return (mPosition == mEnd) ? '\0' : *mPosition;
+	}
+
+	void ScopeTextReader::Fail(const char* reason) const
+	{
+		throw std::runtime_error(std::string(reason).append(" offset = ").append(std::to_string(mPosition - mBegin)));
+	}
+
+	Datum::DatumType ScopeTextReader::InferType(const std::string& value)
+	{
+		// only numbers are made of these characters, which saves trying to parse ordinary strings
+		if (value.empty() || value.find_first_not_of("0123456789+-.eE, \t") != std::string::npos)
+		{
+			return Datum::DatumType::String;
+		}
+
+		const char* end = value.c_str() + value.size();
+		try
+		{
+			std::int32_t integer;
+			if (NumberParser::Parse(value.c_str(), end, integer) == end)
+			{
+				return Datum::DatumType::Integer;
+			}
+		}
+		catch (const std::logic_error&)
+		{
+		}
+		if (IsFloatList(value, 1))
+		{
+			return Datum::DatumType::Float;
+		}
+		if (IsFloatList(value, 4))
+		{
+			return Datum::DatumType::Vector;
+		}
+		if (IsFloatList(value, 16))
+		{
+			return Datum::DatumType::Matrix;
+		}
+		return Datum::DatumType::String;
+	}
+
+	bool ScopeTextReader::IsFloatList(const std::string& value, std::uint32_t count)
+	{
+		const char* position = value.c_str();
+		const char* end = position + value.size();
+		try
+		{
+			for (std::uint32_t index = 0; index < count; ++index)
+			{
+				float component;
+				position = NumberParser::Parse(position, end, component);
+				if (index + 1 < count)
+				{
+					if (position == end || *position != ',')
+					{
+						return false;
+					}
+					++position;
+				}
+			}
+		}
+		catch (const std::logic_error&)
+		{
+			return false;
+		}
+		return position == end;
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "Scope.h"
+#include "Vector.h"
+
+namespace AnonymousEngine
+{
+	/** Reads the text written by ScopeTextWriter and Scope::ToString back into a scope.
+	 *
+	 *  The text doesn't record the type of a value, so datums which already have a type, such as prescribed attributes,
+	 *  keep it and parse their values with Datum::SetFromString. Datums without a type get the first type their first
+	 *  value parses as completely, trying integer, float, vector and matrix before falling back to string. Nested
+	 *  scopes which already exist are filled in place and the rest are appended. RTTI values can't be restored and are
+	 *  skipped
+	 */
+	class ScopeTextReader final
+	{
+	public:
+		/** Initialize a reader
+		 */
+		ScopeTextReader();
+		/** Free up allocated resources
+		 */
+		~ScopeTextReader() = default;
+
+		// Delete move and copy semantics
+		ScopeTextReader(const ScopeTextReader&) = delete;
+		ScopeTextReader& operator=(const ScopeTextReader&) = delete;
+
+		/** Read scope text into a scope
+		 *  @param text The text to read
+		 *  @param scope The scope to fill
+		 *  @exception std::runtime_error Thrown if the text is malformed or doesn't fit the types and sizes of the
+		 *  prescribed attributes of the scope
+		 */
+		void Read(const std::string& text, Scope& scope);
+
+	private:
+		// Read a scope object into a scope
+		void ReadScope(Scope& scope);
+		// Read a member of a scope object, either one value or an array of values
+		void ReadMember(Scope& scope);
+		// Read a scope value of a member, filling an existing nested scope if there is one
+		void ReadScopeValue(Scope& scope, const std::string& key, Datum& datum, std::uint32_t index);
+		// Read a quoted string, removing escapes
+		void ReadString(std::string& value);
+		// Store the gathered string values in a datum
+		void StoreValues(Datum& datum, const std::string& key, std::uint32_t count);
+		// Skip whitespace
+		void SkipWhitespace();
+		// Consume an expected character
+		void Expect(char character);
+		// Peek at the next character after whitespace
+		char Peek();
+		// Throw an exception describing where the text is malformed
+		void Fail(const char* reason) const;
+		// Find the type a value parses as completely
+		static Datum::DatumType InferType(const std::string& value);
+		// Whether a value is a list of floats separated by commas
+		static bool IsFloatList(const std::string& value, std::uint32_t count);
+
+		// The text being read and the read position in it
+		const char* mBegin;
+		const char* mPosition;
+		const char* mEnd;
+		// The string values of the member being read, reused to keep their capacity
+		Vector<std::string> mValues;
+	};
+}
@@ -0,0 +1,216 @@
+#include "ScopeTextWriter.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <glm/gtc/type_ptr.hpp>
+#include "NumberParser.h"
+
+namespace AnonymousEngine
+{
+	const std::size_t ScopeTextWriter::ChunkSize = 64U * 1024U;
+
+	ScopeTextWriter::ScopeTextWriter(FloatFormat floatFormat) :
+		mFloatFormat(floatFormat), mBuffer(), mOut(nullptr)
+	{
+	}
+
+	const std::string& ScopeTextWriter::Write(const Scope& scope)
+	{
+		mBuffer.clear();
+		mOut = nullptr;
+		WriteScope(scope);
+		return mBuffer;
+	}
+
+	void ScopeTextWriter::Write(const Scope& scope, std::ostream& out)
+	{
+		mBuffer.clear();
+		mOut = &out;
+		try
+		{
+			WriteScope(scope);
+			Flush();
+		}
+		catch (...)
+		{
+			mOut = nullptr;
+			throw;
+		}
+		mOut = nullptr;
+	}
+
+	void ScopeTextWriter::WriteScope(const Scope& scope)
+	{
+		mBuffer.push_back('{');
+		bool isFirst = true;
+		for (std::uint32_t index = 0; index < scope.Size(); ++index)
+		{
+			const std::string& key = scope.GetKey(index);
+			const Datum& datum = scope[index];
+			std::uint32_t size = datum.Size();
+			if (size == 0 || key == "this")
+			{
+				continue;
+			}
+
+			if (!isFirst)
+			{
+				mBuffer.append(", ");
+			}
+			isFirst = false;
+			mBuffer.push_back('"');
+			mBuffer.append(key);
+			mBuffer.append((size > 1) ? "\": [" : "\": ");
+			for (std::uint32_t valueIndex = 0; valueIndex < size; ++valueIndex)
+			{
+				if (valueIndex > 0)
+				{
+					mBuffer.append(", ");
+				}
+				WriteValue(datum, valueIndex);
+			}
+			if (size > 1)
+			{
+				mBuffer.push_back(']');
+			}
+			FlushIfFull();
+		}
+		mBuffer.push_back('}');
+	}
+
+	void ScopeTextWriter::WriteValue(const Datum& datum, std::uint32_t index)
+	{
+		if (datum.Type() == Datum::DatumType::Scope)
+		{
+			WriteScope(datum.Get<Scope>(index));
+			return;
+		}
+
+		mBuffer.push_back('"');
+		switch (datum.Type())
+		{
+		case Datum::DatumType::Integer:
+			WriteInteger(datum.Get<std::int32_t>(index));
+			break;
+		case Datum::DatumType::Float:
+			WriteFloat(datum.Get<float>(index));
+			break;
+		case Datum::DatumType::String:
+			WriteString(datum.Get<std::string>(index));
+			break;
+		case Datum::DatumType::Vector:
+			WriteFloats(glm::value_ptr(datum.Get<glm::vec4>(index)), 4);
+			break;
+		case Datum::DatumType::Matrix:
+			WriteFloats(glm::value_ptr(datum.Get<glm::mat4>(index)), 16);
+			break;
+		default:
+			// pointers format themselves, as they always have
+			mBuffer.append(datum.ToString(index));
+			break;
+		}
+		mBuffer.push_back('"');
+	}
+
+	void ScopeTextWriter::WriteFloats(const float* values, std::uint32_t count)
+	{
+		for (std::uint32_t index = 0; index < count; ++index)
+		{
+			if (index > 0)
+			{
+				mBuffer.push_back(',');
+			}
+			WriteFloat(values[index]);
+		}
+	}
+
+	void ScopeTextWriter::WriteFloat(float value)
+	{
+		// large enough for every float printed with six decimals
+		char text[64];
+		int length;
+		if (mFloatFormat == FloatFormat::Fixed || !std::isfinite(value))
+		{
+			length = std::snprintf(text, sizeof(text), "%f", value);
+		}
+		else
+		{
+			// nine significant digits always round trip, most floats need far fewer. The text is parsed in place, so no
+			// attempt allocates
+			float parsed;
+			for (int precision = 1; ; ++precision)
+			{
+				length = std::snprintf(text, sizeof(text), "%.*g", precision, value);
+				if (precision == 9)
+				{
+					break;
+				}
+				NumberParser::Parse(text, text + length, parsed);
+				if (parsed == value)
+				{
+					break;
+				}
+			}
+			// a whole number would be read back as an integer, so keep it looking like a float
+			if (std::strpbrk(text, ".e") == nullptr)
+			{
+				text[length++] = '.';
+				text[length++] = '0';
+			}
+		}
+		mBuffer.append(text, static_cast<std::size_t>(length));
+	}
+
+	void ScopeTextWriter::WriteInteger(std::int32_t value)
+	{
+		char text[12];
+		char* end = text + sizeof(text);
+		char* begin = end;
+		std::uint32_t magnitude = (value < 0) ? (0U - static_cast<std::uint32_t>(value)) : static_cast<std::uint32_t>(value);
+		do
+		{
+			*--begin = static_cast<char>('0' + magnitude % 10);
+			magnitude /= 10;
+		} while (magnitude != 0);
+		if (value < 0)
+		{
+			*--begin = '-';
+		}
+		mBuffer.append(begin, end);
+	}
+
+	void ScopeTextWriter::WriteString(const std::string& value)
+	{
+		if (value.find_first_of("\"\\") == std::string::npos)
+		{
+			mBuffer.append(value);
+			return;
+		}
+		for (char character : value)
+		{
+			if (character == '"' || character == '\\')
+			{
+				mBuffer.push_back('\\');
+			}
+			mBuffer.push_back(character);
+		}
+	}
+
+	void ScopeTextWriter::FlushIfFull()
+	{
+		if (mOut != nullptr && mBuffer.size() >= ChunkSize)
+		{
+			Flush();
+		}
+	}
+
+	void ScopeTextWriter::Flush()
+	{
+		mOut->write(mBuffer.c_str(), mBuffer.size());
+		if (!*mOut)
+		{
+			throw std::runtime_error("Unable to write the scope text.");
+		}
+		mBuffer.clear();
+	}
+}
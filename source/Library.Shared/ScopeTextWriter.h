@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "Scope.h"
+
+namespace AnonymousEngine
+{
+	/** Writes scopes in the text format of Scope::ToString, straight into a reusable buffer or a stream.
+	 *
+	 *  Numbers are formatted into a stack buffer and nested scopes are written recursively, so no temporary string is
+	 *  made per value and a writer which is reused keeps the capacity of its buffer. Quotes and backslashes inside
+	 *  strings are escaped with a backslash so ScopeTextReader can read every string back, otherwise the output is the
+	 *  same byte for byte as it has always been
+	 */
+	class ScopeTextWriter final
+	{
+	public:
+		/** How floats, vectors and matrices are formatted
+		 */
+		enum class FloatFormat
+		{
+			// Six decimals, like std::to_string. This is the format of Scope::ToString
+			Fixed,
+			// The fewest digits which parse back to exactly the same float
+			Shortest
+		};
+
+		/** Initialize a writer
+		 *  @param floatFormat How floats are formatted
+		 */
+		explicit ScopeTextWriter(FloatFormat floatFormat = FloatFormat::Fixed);
+		/** Free up allocated resources
+		 */
+		~ScopeTextWriter() = default;
+
+		// Delete move and copy semantics
+		ScopeTextWriter(const ScopeTextWriter&) = delete;
+		ScopeTextWriter& operator=(const ScopeTextWriter&) = delete;
+
+		/** Write a scope into the buffer of the writer, replacing what was there
+		 *  @param scope The scope to write
+		 *  @return The buffer holding the text. It is valid until the next write
+		 */
+		const std::string& Write(const Scope& scope);
+		/** Write a scope to a stream. The text goes out in chunks, so the whole text is never held in memory
+		 *  @param scope The scope to write
+		 *  @param out The stream to write to
+		 *  @exception std::runtime_error Thrown if writing to the stream fails
+		 */
+		void Write(const Scope& scope, std::ostream& out);
+
+	private:
+		// Append a scope and everything under it
+		void WriteScope(const Scope& scope);
+		// Append one value of a datum
+		void WriteValue(const Datum& datum, std::uint32_t index);
+		// Append floats separated by commas
+		void WriteFloats(const float* values, std::uint32_t count);
+		// Append a float in the format of the writer
+		void WriteFloat(float value);
+		// Append an integer
+		void WriteInteger(std::int32_t value);
+		// Append a string, escaping quotes and backslashes
+		void WriteString(const std::string& value);
+		// Pass the buffer on to the stream once it holds a full chunk
+		void FlushIfFull();
+		// Pass the whole buffer on to the stream
+		void Flush();
+
+		// How many bytes are gathered before they are passed on to a stream
+		static const std::size_t ChunkSize;
+
+		// How floats are formatted
+		FloatFormat mFloatFormat;
+		// The text written so far, or the part not yet passed on to the stream
+		std::string mBuffer;
+		// The stream being written to, if any
+		std::ostream* mOut;
+	};
+}
@@ -35,7 +35,7 @@ namespace AnonymousEngine
 
 		World& Sector::GetWorld()
 		{
-			assert(GetParent()->Is(World::TypeIdClass()));
+			assert(GetParent()->Is<World>());
 			return *(static_cast<World*>(GetParent()));
 		}
 
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+
+namespace AnonymousEngine
+{
+	/** A view of a contiguous run of items which it doesn't own, such as the items of a Vector. Iteration goes through
+	 *  raw pointers and indexing isn't checked, so loops over a span compile down to plain pointer loops. A span is only
+	 *  valid until the container it views grows or shrinks
+	 */
+	template <typename T>
+	class Span final
+	{
+	public:
+		/** Initialize an empty span
+		 */
+		Span() :
+			mData(nullptr), mSize(0)
+		{
+		}
+
+		/** Initialize a span over a run of items
+		 *  @param data The first item
+		 *  @param size The number of items
+		 */
+		Span(T* data, std::uint32_t size) :
+			mData(data), mSize(size)
+		{
+		}
+
+		/** Get the first item
+		 *  @return A pointer to the first item, or nullptr if the span is empty and views nothing
+		 */
+		T* Data() const
+		{
+			return mData;
+		}
+
+		/** Get the number of items
+		 *  @return The number of items in the span
+		 */
+		std::uint32_t Size() const
+		{
+			return mSize;
+		}
+
+		/** Check whether the span is empty
+		 *  @return Whether the span has no items
+		 */
+		bool IsEmpty() const
+		{
+			return (mSize == 0);
+		}
+
+		/** Get the item at the given index. The index is not checked
+		 *  @param index The index of the item, which has to be less than Size
+		 *  @return The item at the given index
+		 */
+		T& operator[](std::uint32_t index) const
+		{
+			return mData[index];
+		}
+
+		/** Get the beginning of the span
+		 *  @return A pointer to the first item
+		 */
+		T* begin() const
+		{
+			return mData;
+		}
+
+		/** Get the end of the span
+		 *  @return A pointer one past the last item
+		 */
+		T* end() const
+		{
+			return mData + mSize;
+		}
+
+	private:
+		T* mData;
+		std::uint32_t mSize;
+	};
+}
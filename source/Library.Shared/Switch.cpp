@@ -30,7 +30,7 @@ namespace AnonymousEngine
 				bool foundCase = false;
 				for (std::uint32_t index = 0; index < mActions->Size(); ++index)
 				{
-					assert(mActions->Get<Scope>(index).Is(Action::TypeIdClass()));
+					assert(mActions->Get<Scope>(index).Is<Action>());
 					Action& action = static_cast<Action&>(mActions->Get<Scope>(index));
 					
 					// create a datum from the case to compare against
@@ -49,7 +49,7 @@ namespace AnonymousEngine
 
 				if (!foundCase && mDefaultCase->Size() > 0)
 				{
-					assert(mDefaultCase->Get<Scope>().Is(Action::TypeIdClass()));
+					assert(mDefaultCase->Get<Scope>().Is<Action>());
 					Action& action = static_cast<Action&>(mDefaultCase->Get<Scope>());
 					action.Update(worldState);
 				}
@@ -2,12 +2,28 @@
 
 #include <cstdint>
 #include <initializer_list>
-#include "CapacityStrategy.h"
+#include <type_traits>
+#include "Span.h"
+#include "VectorGrowthPolicy.h"
 
 namespace AnonymousEngine
 {
+	/** Whether objects of a type can be moved to another address by copying their bytes, without running a constructor or
+	 *  destructor. Vector grows these with realloc and shifts them with memmove, and moves the rest one by one.
+	 *  Trivially copyable types qualify. Specialize it for other types whose bytes don't depend on their address
+	 */
 	template <typename T>
-	class Vector
+	struct IsTriviallyRelocatable : std::integral_constant<bool, std::is_trivially_copyable<T>::value>
+	{
+	};
+
+	/** A contiguous dynamic array
+	 *  @tparam T The type of the elements
+	 *  @tparam TGrowthPolicy The functor deciding how much the capacity grows when the vector is full. Use
+	 *  CapacityStrategyAdaptor to choose a CapacityStrategy at runtime with IncrementStrategy
+	 */
+	template <typename T, typename TGrowthPolicy = GeometricGrowthPolicy>
+	class Vector : private TGrowthPolicy
 	{
 	public:
 		class Iterator
@@ -57,17 +73,19 @@ namespace AnonymousEngine
 			 */
 			Iterator end() const;
 		private:
-			std::uint32_t mIndex;
-			Vector<T>* mOwner;
+			T* mPointer;
+			Vector* mOwner;
 
-			Iterator(const std::uint32_t index, Vector<T>* owner);
-			friend Vector<T>;
+			Iterator(const std::uint32_t index, Vector* owner);
+			// the index of the item the iterator points to in its owner
+			std::uint32_t Index() const;
+			friend Vector;
 		};
 
-		/** Constructs a new vector
-		 *  @param capacity The initial capacity of the vector. Default capacity is 3 elements
+		/** Constructs a new vector. A vector without an initial capacity allocates nothing until the first push
+		 *  @param capacity The initial capacity of the vector
 		 */
-		Vector(std::uint32_t capacity = DefaultCapacity);
+		Vector(std::uint32_t capacity = 0);
 
 		/** Constrycts a vector from an initializer list
 		 *  @param items The initializer list from which the vector has to be initialized
@@ -102,6 +120,19 @@ namespace AnonymousEngine
 		 */
 		Iterator PushBack(const T& data);
 
+		/** Move an item to the back of the vector
+		 *	@param data The data item to move to the back of the vector
+		 *	@return An iterator to the current data that is pushed
+		 */
+		Iterator PushBack(T&& data);
+
+		/** Construct an item in place at the back of the vector
+		 *	@param args The arguments passed on to the constructor of the item. They must not refer to items of this vector
+		 *	@return An iterator to the constructed item
+		 */
+		template <typename... TArgs>
+		Iterator EmplaceBack(TArgs&&... args);
+
 		/** Push another vector to the back of the vector
 		 *	@param vector The other vector to push to the back of the vector
 		 *	@return An iterator to the start of the new data that is pushed
@@ -170,6 +201,28 @@ namespace AnonymousEngine
 		 */
 		const T& operator[](std::uint32_t index) const;
 
+		/** Get the items as one contiguous array
+		 *  @return A pointer to the first item, valid until the vector grows. nullptr if nothing was ever allocated
+		 */
+		T* Data();
+
+		/** Get the items as one contiguous array. This is the constant version
+		 *  @return A pointer to the first item, valid until the vector grows. nullptr if nothing was ever allocated
+		 */
+		const T* Data() const;
+
+		/** Get a view of the items which iterates with raw pointers and doesn't check indices. Tight loops which don't
+		 *  add or remove items should prefer it to the checked iterators
+		 *  @return A span over the items, valid until the vector grows or shrinks
+		 */
+		Span<T> Items();
+
+		/** Get a view of the items which iterates with raw pointers and doesn't check indices. This is the constant
+		 *  version
+		 *  @return A span over the items, valid until the vector grows or shrinks
+		 */
+		Span<const T> Items() const;
+
 		/** Get the beginning of the container
 		 *  @returns An iterator pointing to the start of the container
 		 */
@@ -204,13 +257,34 @@ namespace AnonymousEngine
 		 */
 		bool Remove(const Iterator& first, const Iterator& last);
 
+		/** Removes an element by moving the last element into its place. Faster than Remove, but the order of the
+		 *  elements is not kept
+		 *  @param it An Iterator pointing to the element to be removed
+		 *  @return A boolean indicating whether an element was removed or not
+		 *  @exception std::invalid_argument Thrown if the iterator doesn't belong to this vector
+		 */
+		bool SwapRemove(const Iterator& it);
+
+		/** Inserts a range of items before the given position
+		 *  @param position An Iterator pointing to the element before which the items are inserted, or end
+		 *  @param first An iterator to the first item to insert. Any iterator supporting ++, * and != works, including
+		 *  pointers and iterators into this vector. Nothing changes if copying an item throws
+		 *  @param last An iterator one past the last item to insert
+		 *  @return An iterator to the first inserted item
+		 *  @exception std::invalid_argument Thrown if the position doesn't belong to this vector
+		 */
+		template <typename TIterator>
+		Iterator Insert(const Iterator& position, TIterator first, TIterator last);
+
 		/** Reserves enough memory to allocate the given number of items or existing capacity whichever is the maximum
 		 *  @param capacity The capacity in number of elements to reserve
 		 */
 		void Reserve(std::uint32_t capacity);
 
-		/** Supply an capacity increment strategy functor which will be used by vector class to expand
-		 *  @param strategy The functor which accepts current size and capacity to return a capacity increment
+		/** Supply an capacity increment strategy functor which will be used by vector class to expand. Only available
+		 *  when the growth policy is CapacityStrategyAdaptor
+		 *  @param strategy The functor which accepts current size and capacity to return a capacity increment. The
+		 *  vector doesn't take ownership of it. nullptr restores the default growth
 		 */
 		void IncrementStrategy(const CapacityStrategy* strategy);
 
@@ -225,16 +299,25 @@ namespace AnonymousEngine
 		T* mData;
 		std::uint32_t mSize;
 		std::uint32_t mCapacity;
-		const CapacityStrategy* mStrategy;
-		const CapacityStrategy* mDefaultStrategy;
 
 		// copies data from one list to another. Used in copy constructor and copy assignment operator
-		void Copy(const Vector<T>& rhs);
+		void Copy(const Vector& rhs);
 
 		// moves data from one list to another. Used in move constructor and move assignment operator
-		void Move(Vector<T>& rhs);
+		void Move(Vector& rhs);
+
+		// grows the capacity with the growth policy if the vector is full
+		void GrowIfFull();
+
+		// reallocates the storage, either with realloc or by moving each item
+		void Reallocate(std::uint32_t capacity, std::true_type);
+		void Reallocate(std::uint32_t capacity, std::false_type);
 
-		const static std::uint32_t DefaultCapacity;
+		// destroys a run of constructed items without freeing their memory
+		static void Destroy(T* data, std::uint32_t count);
+		// moves items to uninitialized memory which may overlap them, leaving the sources destroyed
+		static void Relocate(T* destination, T* source, std::uint32_t count, std::true_type);
+		static void Relocate(T* destination, T* source, std::uint32_t count, std::false_type);
 	};
 }
 
@@ -1,65 +1,75 @@
 #include <algorithm>
-#include "DefaultVectorCapacityStrategy.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
 namespace AnonymousEngine
 {
 #pragma region IteratorMethods
 
-	template <typename T>
-	Vector<T>::Iterator::Iterator() :
-		mIndex(0), mOwner(nullptr)
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>::Iterator::Iterator() :
+		mPointer(nullptr), mOwner(nullptr)
 	{
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator& Vector<T, TGrowthPolicy>::Iterator::operator++()
 	{
-		if (mOwner == nullptr || mIndex == mOwner->mSize)
+		if (mOwner == nullptr || mPointer == mOwner->mData + mOwner->mSize)
 		{
 			throw std::out_of_range("Iterator out of range");
 		}
-		++mIndex;
+		++mPointer;
 		return *this;
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::Iterator::operator++(int)
 	{
 		Iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template <typename T>
-	T& Vector<T>::Iterator::operator*() const
+	template <typename T, typename TGrowthPolicy>
+	T& Vector<T, TGrowthPolicy>::Iterator::operator*() const
 	{
-		if (mOwner == nullptr || mIndex == mOwner->mSize)
+		if (mOwner == nullptr || mPointer == mOwner->mData + mOwner->mSize)
 		{
 			throw std::out_of_range("Iterator out of range");
 		}
-		return mOwner->mData[mIndex];
+		return *mPointer;
 	}
 
-	template <typename T>
-	bool Vector<T>::Iterator::operator==(const Iterator& rhs) const
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::Iterator::operator==(const Iterator& rhs) const
 	{
-		return (mOwner == rhs.mOwner && mIndex == rhs.mIndex);
+		return (mOwner == rhs.mOwner && mPointer == rhs.mPointer);
 	}
 
-	template <typename T>
-	bool Vector<T>::Iterator::operator!=(const Iterator& rhs) const
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		return !(*this == rhs);
 	}
 
-	template <typename T>
-	Vector<T>::Iterator::Iterator(const std::uint32_t index, Vector<T>* owner) :
-		mIndex(index), mOwner(owner)
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>::Iterator::Iterator(const std::uint32_t index, Vector* owner) :
+		mPointer(owner->mData + index), mOwner(owner)
 	{
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::Iterator::end() const
+	template <typename T, typename TGrowthPolicy>
+	std::uint32_t Vector<T, TGrowthPolicy>::Iterator::Index() const
+	{
+		return static_cast<std::uint32_t>(mPointer - mOwner->mData);
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::Iterator::end() const
 	{
 		return (mOwner != nullptr) ? mOwner->end() : Iterator();
 	}
@@ -68,20 +78,16 @@ namespace AnonymousEngine
 
 #pragma region VectorMethods
 
-	template <typename T>
-	const std::uint32_t Vector<T>::DefaultCapacity = 3U;
-
-	template <typename T>
-	Vector<T>::Vector(std::uint32_t capacity) :
-		mData(nullptr), mSize(0), mCapacity(0), mStrategy(nullptr), mDefaultStrategy(new DefaultVectorCapacityStrategy())
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>::Vector(std::uint32_t capacity) :
+		TGrowthPolicy(), mData(nullptr), mSize(0), mCapacity(0)
 	{
-		mStrategy = mDefaultStrategy;
 		Reserve(capacity);
 	}
 
-	template <typename T>
-	Vector<T>::Vector(const std::initializer_list<T>& items) :
-		Vector(std::max(static_cast<std::uint32_t>(items.size()), DefaultCapacity))
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>::Vector(const std::initializer_list<T>& items) :
+		Vector(static_cast<std::uint32_t>(items.size()))
 	{
 		for (const auto& item : items)
 		{
@@ -89,15 +95,15 @@ namespace AnonymousEngine
 		}
 	}
 
-	template <typename T>
-	Vector<T>::Vector(const Vector& rhs) :
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>::Vector(const Vector& rhs) :
 		Vector()
 	{
 		Copy(rhs);
 	}
 
-	template <typename T>
-	Vector<T>& Vector<T>::operator=(const Vector& rhs)
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>& Vector<T, TGrowthPolicy>::operator=(const Vector& rhs)
 	{
 		if (this != &rhs)
 		{
@@ -107,15 +113,15 @@ namespace AnonymousEngine
 		return (*this);
 	}
 
-	template <typename T>
-	Vector<T>::Vector(Vector&& rhs) noexcept :
-		mDefaultStrategy(new DefaultVectorCapacityStrategy())
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>::Vector(Vector&& rhs) noexcept :
+		TGrowthPolicy(), mData(nullptr), mSize(0), mCapacity(0)
 	{
 		Move(rhs);
 	}
 
-	template <typename T>
-	Vector<T>& Vector<T>::operator=(Vector&& rhs) noexcept
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>& Vector<T, TGrowthPolicy>::operator=(Vector&& rhs) noexcept
 	{
 		if (this != &rhs)
 		{
@@ -125,37 +131,58 @@ namespace AnonymousEngine
 		return (*this);
 	}
 
-	template <typename T>
-	std::uint32_t Vector<T>::Size() const
+	template <typename T, typename TGrowthPolicy>
+	std::uint32_t Vector<T, TGrowthPolicy>::Size() const
 	{
 		return mSize;
 	}
 
-	template <typename T>
-	std::uint32_t Vector<T>::Capacity() const
+	template <typename T, typename TGrowthPolicy>
+	std::uint32_t Vector<T, TGrowthPolicy>::Capacity() const
 	{
 		return mCapacity;
 	}
 
-	template <typename T>
-	bool Vector<T>::IsEmpty() const
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::IsEmpty() const
 	{
 		return (mSize == 0);
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::PushBack(const T& data)
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::PushBack(const T& data)
 	{
-		if (mSize == mCapacity)
+		if (mSize == mCapacity && &data >= mData && &data < mData + mSize)
 		{
-			Reserve(mCapacity + (*mStrategy)(mSize, mCapacity));
+			// the item would be gone after growing
+			T copy(data);
+			return EmplaceBack(std::move(copy));
 		}
-		new (&mData[mSize]) T(data);
+		return EmplaceBack(data);
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::PushBack(T&& data)
+	{
+		if (mSize == mCapacity && &data >= mData && &data < mData + mSize)
+		{
+			T moved(std::move(data));
+			return EmplaceBack(std::move(moved));
+		}
+		return EmplaceBack(std::move(data));
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	template <typename... TArgs>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::EmplaceBack(TArgs&&... args)
+	{
+		GrowIfFull();
+		new (&mData[mSize]) T(std::forward<TArgs>(args)...);
 		return Iterator(mSize++, this);
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::PushBack(const Vector& vector)
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::PushBack(const Vector& vector)
 	{
 		if (mSize + vector.Size() > mCapacity)
 		{
@@ -170,8 +197,8 @@ namespace AnonymousEngine
 		return it;
 	}
 
-	template <typename T>
-	bool Vector<T>::PopBack()
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::PopBack()
 	{
 		if (mSize > 0)
 		{
@@ -181,8 +208,8 @@ namespace AnonymousEngine
 		return false;
 	}
 
-	template <typename T>
-	T& Vector<T>::Front()
+	template <typename T, typename TGrowthPolicy>
+	T& Vector<T, TGrowthPolicy>::Front()
 	{
 		if (mSize > 0)
 		{
@@ -191,14 +218,14 @@ namespace AnonymousEngine
 		throw std::out_of_range("Vector is empty");
 	}
 
-	template <typename T>
-	const T& Vector<T>::Front() const
+	template <typename T, typename TGrowthPolicy>
+	const T& Vector<T, TGrowthPolicy>::Front() const
 	{
 		return const_cast<const T&>(const_cast<Vector*>(this)->Front());
 	}
 
-	template <typename T>
-	T& Vector<T>::Back()
+	template <typename T, typename TGrowthPolicy>
+	T& Vector<T, TGrowthPolicy>::Back()
 	{
 		if (mSize > 0)
 		{
@@ -207,14 +234,14 @@ namespace AnonymousEngine
 		throw std::out_of_range("Vector is empty");
 	}
 
-	template <typename T>
-	const T& Vector<T>::Back() const
+	template <typename T, typename TGrowthPolicy>
+	const T& Vector<T, TGrowthPolicy>::Back() const
 	{
 		return const_cast<const T&>(const_cast<Vector*>(this)->Back());
 	}
 
-	template <typename T>
-	bool Vector<T>::operator==(const Vector& rhs) const
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::operator==(const Vector& rhs) const
 	{
 		if (mSize != rhs.mSize)
 		{
@@ -230,14 +257,14 @@ namespace AnonymousEngine
 		return true;
 	}
 
-	template <typename T>
-	bool Vector<T>::operator!=(const Vector& rhs) const
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::operator!=(const Vector& rhs) const
 	{
 		return !(*this == rhs);
 	}
 
-	template <typename T>
-	T& Vector<T>::operator[](std::uint32_t index)
+	template <typename T, typename TGrowthPolicy>
+	T& Vector<T, TGrowthPolicy>::operator[](std::uint32_t index)
 	{
 		if (index >= mSize)
 		{
@@ -246,36 +273,60 @@ namespace AnonymousEngine
 		return mData[index];
 	}
 
-	template <typename T>
-	const T& Vector<T>::operator[](std::uint32_t index) const
+	template <typename T, typename TGrowthPolicy>
+	const T& Vector<T, TGrowthPolicy>::operator[](std::uint32_t index) const
 	{
 		return const_cast<const T&>(const_cast<Vector*>(this)->operator[](index));
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::begin() const
+	template <typename T, typename TGrowthPolicy>
+	T* Vector<T, TGrowthPolicy>::Data()
+	{
+		return mData;
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	const T* Vector<T, TGrowthPolicy>::Data() const
+	{
+		return mData;
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	Span<T> Vector<T, TGrowthPolicy>::Items()
 	{
-		return Iterator(0, const_cast<Vector<T>*>(this));
+		return Span<T>(mData, mSize);
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::end() const
+	template <typename T, typename TGrowthPolicy>
+	Span<const T> Vector<T, TGrowthPolicy>::Items() const
 	{
-		return Iterator(mSize, const_cast<Vector<T>*>(this));
+		return Span<const T>(mData, mSize);
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::IteratorAt(std::uint32_t index) const
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::begin() const
+	{
+		return Iterator(0, const_cast<Vector*>(this));
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::end() const
+	{
+		return Iterator(mSize, const_cast<Vector*>(this));
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::IteratorAt(std::uint32_t index) const
 	{
 		if (index >= mSize)
 		{
 			return end();
 		}
-		return Iterator(index, const_cast<Vector<T>*>(this));
+		return Iterator(index, const_cast<Vector*>(this));
 	}
 
-	template <typename T>
-	typename Vector<T>::Iterator Vector<T>::Find(const T& data) const
+	template <typename T, typename TGrowthPolicy>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::Find(const T& data) const
 	{
 		for (Iterator it = begin(); it != end(); ++it)
 		{
@@ -287,8 +338,8 @@ namespace AnonymousEngine
 		return end();
 	}
 
-	template <typename T>
-	bool Vector<T>::Remove(const T& data)
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::Remove(const T& data)
 	{
  		Iterator it = Find(data);
 		if (it != end())
@@ -299,39 +350,215 @@ namespace AnonymousEngine
 		return false;
 	}
 
-	template <typename T>
-	bool Vector<T>::Remove(const typename Vector<T>::Iterator& first, const typename Vector<T>::Iterator& last)
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::Remove(const typename Vector<T, TGrowthPolicy>::Iterator& first, const typename Vector<T, TGrowthPolicy>::Iterator& last)
 	{
 		if (first.mOwner != this || first.mOwner != last.mOwner)
 		{
 			throw std::invalid_argument("Iterator is not an iterator to this list");
 		}
 
-		if (first.mIndex >= 0 && last.mIndex > first.mIndex && last.mIndex <= mSize)
+		std::uint32_t firstIndex = first.Index();
+		std::uint32_t lastIndex = last.Index();
+		if (lastIndex > firstIndex && lastIndex <= mSize)
 		{
-			for (std::uint32_t i = first.mIndex; i < last.mIndex; i++)
+			for (std::uint32_t i = firstIndex; i < lastIndex; i++)
 			{
 				mData[i].~T();
 			}
-			memmove(&mData[first.mIndex], &mData[last.mIndex], (mSize - last.mIndex) * sizeof(T));
-			mSize -= (last.mIndex - first.mIndex);
+			Relocate(&mData[firstIndex], &mData[lastIndex], mSize - lastIndex, IsTriviallyRelocatable<T>());
+			mSize -= (lastIndex - firstIndex);
+			return true;
+		}
+		return false;
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	bool Vector<T, TGrowthPolicy>::SwapRemove(const Iterator& it)
+	{
+		if (it.mOwner != this)
+		{
+			throw std::invalid_argument("Iterator is not an iterator to this list");
+		}
+
+		std::uint32_t index = it.Index();
+		if (index < mSize)
+		{
+			mData[index].~T();
+			if (index != mSize - 1)
+			{
+				Relocate(&mData[index], &mData[mSize - 1], 1, IsTriviallyRelocatable<T>());
+			}
+			--mSize;
 			return true;
 		}
 		return false;
 	}
 
-	template <typename T>
-	void Vector<T>::Reserve(std::uint32_t capacity)
+	template <typename T, typename TGrowthPolicy>
+	template <typename TIterator>
+	typename Vector<T, TGrowthPolicy>::Iterator Vector<T, TGrowthPolicy>::Insert(const Iterator& position, TIterator first, TIterator last)
+	{
+		if (position.mOwner != this || position.Index() > mSize)
+		{
+			throw std::invalid_argument("Iterator is not an iterator to this list");
+		}
+		std::uint32_t index = position.Index();
+
+		std::uint32_t count = 0;
+		for (TIterator it = first; it != last; ++it)
+		{
+			++count;
+		}
+		if (count == 0)
+		{
+			return Iterator(index, this);
+		}
+
+		// the range may come from this vector, so the items are copied before any existing element is moved or freed
+		if (mSize + count > mCapacity)
+		{
+			std::uint32_t capacity = mCapacity + static_cast<const TGrowthPolicy&>(*this)(mSize, mCapacity);
+			if (capacity < mSize + count)
+			{
+				capacity = mSize + count;
+			}
+			T* data = static_cast<T*>(malloc(sizeof(T) * capacity));
+			if (data == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			std::uint32_t constructed = 0;
+			try
+			{
+				for (; first != last; ++first, ++constructed)
+				{
+					new (&data[index + constructed]) T(*first);
+				}
+			}
+			catch (...)
+			{
+				Destroy(&data[index], constructed);
+				free(data);
+				throw;
+			}
+			Relocate(data, mData, index, IsTriviallyRelocatable<T>());
+			Relocate(&data[index + count], &mData[index], mSize - index, IsTriviallyRelocatable<T>());
+			free(mData);
+			mData = data;
+			mCapacity = capacity;
+		}
+		else
+		{
+			// build the items past the end, where they overwrite nothing, then rotate them into place
+			std::uint32_t constructed = 0;
+			try
+			{
+				for (; first != last; ++first, ++constructed)
+				{
+					new (&mData[mSize + constructed]) T(*first);
+				}
+			}
+			catch (...)
+			{
+				Destroy(&mData[mSize], constructed);
+				throw;
+			}
+			std::rotate(&mData[index], &mData[mSize], &mData[mSize + count]);
+		}
+		mSize += count;
+		return Iterator(index, this);
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Reserve(std::uint32_t capacity)
 	{
 		if (capacity > mCapacity)
 		{
-			mData = static_cast<T*>(realloc(mData, sizeof(T) * capacity));
+			Reallocate(capacity, IsTriviallyRelocatable<T>());
 			mCapacity = capacity;
 		}
 	}
 
-	template <typename T>
-	void Vector<T>::Clear()
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::GrowIfFull()
+	{
+		if (mSize == mCapacity)
+		{
+			Reserve(mCapacity + static_cast<const TGrowthPolicy&>(*this)(mSize, mCapacity));
+		}
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Reallocate(std::uint32_t capacity, std::true_type)
+	{
+		T* data = static_cast<T*>(realloc(mData, sizeof(T) * capacity));
+		if (data == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+		mData = data;
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Reallocate(std::uint32_t capacity, std::false_type)
+	{
+		T* data = static_cast<T*>(malloc(sizeof(T) * capacity));
+		if (data == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+		Relocate(data, mData, mSize, std::false_type());
+		free(mData);
+		mData = data;
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Relocate(T* destination, T* source, std::uint32_t count, std::true_type)
+	{
+		if (count > 0 && destination != source)
+		{
+			std::memmove(destination, source, sizeof(T) * count);
+		}
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Relocate(T* destination, T* source, std::uint32_t count, std::false_type)
+	{
+		// walk away from the overlap so every source is moved before its memory is reused
+		if (destination == source)
+		{
+			return;
+		}
+		if (destination < source)
+		{
+			for (std::uint32_t index = 0; index < count; ++index)
+			{
+				new (&destination[index]) T(std::move(source[index]));
+				source[index].~T();
+			}
+		}
+		else
+		{
+			for (std::uint32_t index = count; index > 0; --index)
+			{
+				new (&destination[index - 1]) T(std::move(source[index - 1]));
+				source[index - 1].~T();
+			}
+		}
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Destroy(T* data, std::uint32_t count)
+	{
+		for (std::uint32_t index = 0; index < count; ++index)
+		{
+			data[index].~T();
+		}
+	}
+
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Clear()
 	{
 		for (std::uint32_t i = 0; i < mSize; i++)
 		{
@@ -343,28 +570,20 @@ namespace AnonymousEngine
 		mCapacity = 0;
 	}
 
-	template <typename T>
-	Vector<T>::~Vector()
+	template <typename T, typename TGrowthPolicy>
+	Vector<T, TGrowthPolicy>::~Vector()
 	{
 		Clear();
-		delete mDefaultStrategy;
 	}
 
-	template <typename T>
-	void Vector<T>::IncrementStrategy(const CapacityStrategy* strategy)
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::IncrementStrategy(const CapacityStrategy* strategy)
 	{
-		if (strategy == nullptr)
-		{
-			mStrategy = mDefaultStrategy;
-		}
-		else
-		{
-			mStrategy = strategy;
-		}
+		TGrowthPolicy::IncrementStrategy(strategy);
 	}
 
-	template <typename T>
-	void AnonymousEngine::Vector<T>::Copy(const Vector<T>& rhs)
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Copy(const Vector& rhs)
 	{
 		Reserve(rhs.mCapacity);
 		for (std::uint32_t i = 0; i < rhs.mSize; i++)
@@ -373,25 +592,18 @@ namespace AnonymousEngine
 		}
 	}
 
-	template <typename T>
-	void AnonymousEngine::Vector<T>::Move(Vector<T>& rhs)
+	template <typename T, typename TGrowthPolicy>
+	void Vector<T, TGrowthPolicy>::Move(Vector& rhs)
 	{
 		mData = rhs.mData;
 		mSize = rhs.mSize;
 		mCapacity = rhs.mCapacity;
-		if (rhs.mStrategy == rhs.mDefaultStrategy)
-		{
-			mStrategy = mDefaultStrategy;
-		}
-		else
-		{
-			mStrategy = rhs.mStrategy;
-		}
-		
+		static_cast<TGrowthPolicy&>(*this) = static_cast<TGrowthPolicy&>(rhs);
+
 		rhs.mData = nullptr;
 		rhs.mSize = 0;
 		rhs.mCapacity = 0;
-		rhs.mStrategy = rhs.mDefaultStrategy;
+		static_cast<TGrowthPolicy&>(rhs) = TGrowthPolicy();
 	}
 
 #pragma endregion
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include "CapacityStrategy.h"
+
+namespace AnonymousEngine
+{
+	/** Default growth policy of the Vector container. The first allocation holds 3 elements and every allocation after
+	 *  that doubles the capacity. Growth policies are plain functors without virtual functions, so the call is inlined
+	 *  and an empty policy takes no space in the vector
+	 */
+	class GeometricGrowthPolicy
+	{
+	public:
+		/** Provide a capacity increment value given the current size and current capacity of the vector
+		 *  @param size The current size of the vector
+		 *  @param capacity The current capacity of the vector
+		 *  @return The increment by which capacity should be incremented
+		 */
+		inline std::uint32_t operator()(std::uint32_t size, std::uint32_t capacity) const
+		{
+			if (capacity == 0)
+			{
+				return 3;
+			}
+			else
+			{
+				return size;
+			}
+		}
+	};
+
+	/** Growth policy which forwards to a CapacityStrategy chosen at runtime. A vector using it gets an IncrementStrategy
+	 *  method and pays for the pointer and the virtual call, so only vectors which need to swap strategies should use it
+	 */
+	class CapacityStrategyAdaptor
+	{
+	public:
+		/** Construct an adaptor which grows like GeometricGrowthPolicy until a strategy is supplied
+		 */
+		CapacityStrategyAdaptor() :
+			mStrategy(nullptr)
+		{
+		}
+
+		/** Supply the capacity increment strategy to forward to
+		 *  @param strategy The strategy, which the adaptor doesn't take ownership of. nullptr restores the default growth
+		 */
+		inline void IncrementStrategy(const CapacityStrategy* strategy)
+		{
+			mStrategy = strategy;
+		}
+
+		/** Provide a capacity increment value given the current size and current capacity of the vector
+		 *  @param size The current size of the vector
+		 *  @param capacity The current capacity of the vector
+		 *  @return The increment by which capacity should be incremented
+		 */
+		inline std::uint32_t operator()(std::uint32_t size, std::uint32_t capacity) const
+		{
+			return (mStrategy != nullptr) ? (*mStrategy)(size, capacity) : GeometricGrowthPolicy()(size, capacity);
+		}
+
+	private:
+		const CapacityStrategy* mStrategy;
+	};
+}
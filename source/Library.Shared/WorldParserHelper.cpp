@@ -3,13 +3,14 @@
 #include <cassert>
 #include "Action.h"
 #include "Entity.h"
+#include "NumberParser.h"
 #include "Sector.h"
 #include "World.h"
 #include "WorldSharedData.h"
 
 #define ValidateRequiredAttributes(attributes) assert(attributes.ContainsKey(NAME))
 #define ValidateSharedDataNotNull(sharedData) assert(sharedData.mAttributed != nullptr)
-#define ValidateSharedDataScopeType(sharedData, Type) assert(sharedData.mAttributed->Is(Type::TypeIdClass()))
+#define ValidateSharedDataScopeType(sharedData, Type) assert(sharedData.mAttributed->Is<Type>())
 #define ValidateFactoryInputAttributes(attributes) assert(attributes.ContainsKey(CLASS))
 #define ValidateParentIsList(sharedData, listTypeString) assert(sharedData.mElementStack[sharedData.mElementStack.Size()-1] == listTypeString)
 
@@ -66,27 +67,44 @@ namespace AnonymousEngine
 			return helper;
 		}
 
+		Vector<std::string> WorldParserHelper::Tags() const
+		{
+			Vector<std::string> tags(StartElementHandlers.Size());
+			for (const auto& handler : StartElementHandlers)
+			{
+				tags.PushBack(handler.first);
+			}
+			return tags;
+		}
+
+		bool WorldParserHelper::IsSharedDataSupported(const SharedData& sharedData) const
+		{
+			return sharedData.Is<WorldSharedData>();
+		}
+
 		bool WorldParserHelper::StartElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes)
 		{
-			if (!sharedData.Is(WorldSharedData::TypeIdClass()) || !StartElementHandlers.ContainsKey(name))
+			WorldSharedData* data = sharedData.As<WorldSharedData>();
+			auto it = StartElementHandlers.Find(name);
+			if (data == nullptr || it == StartElementHandlers.end())
 			{
 				return false;
 			}
-			WorldSharedData& data = *(sharedData.As<WorldSharedData>());
-			StartElementHandlers[name](data, attributes);
-			data.mElementStack.PushBack(name);
+			it->second(*data, attributes);
+			data->mElementStack.PushBack(name);
 			return true;
 		}
 
 		bool WorldParserHelper::EndElementHandler(SharedData& sharedData, const std::string& name)
 		{
-			if (!sharedData.Is(WorldSharedData::TypeIdClass()) || !EndElementHandlers.ContainsKey(name))
+			WorldSharedData* data = sharedData.As<WorldSharedData>();
+			auto it = EndElementHandlers.Find(name);
+			if (data == nullptr || it == EndElementHandlers.end())
 			{
 				return false;
 			}
-			WorldSharedData& data = *(sharedData.As<WorldSharedData>());
-			EndElementHandlers[name](data);
-			data.mElementStack.PopBack();
+			it->second(*data);
+			data->mElementStack.PopBack();
 			return true;
 		}
 
@@ -115,7 +133,7 @@ namespace AnonymousEngine
 			ValidateSharedDataNotNull(sharedData);
 			ValidateRequiredAttributes(attributes);
 			Datum& datum = sharedData.mAttributed->Append(attributes[NAME]);
-			UpdateOrAddDatumValue<std::int32_t>(datum, std::stoi(attributes[VALUE]), attributes);
+			UpdateOrAddDatumValue<std::int32_t>(datum, NumberParser::ToInt(attributes[VALUE]), attributes);
 		}
 
 		void WorldParserHelper::HandleFloatStart(WorldSharedData& sharedData, const AttributeMap& attributes)
@@ -123,7 +141,7 @@ namespace AnonymousEngine
 			ValidateSharedDataNotNull(sharedData);
 			ValidateRequiredAttributes(attributes);
 			Datum& datum = sharedData.mAttributed->Append(attributes[NAME]);
-			UpdateOrAddDatumValue<float>(datum, std::stof(attributes[VALUE]), attributes);
+			UpdateOrAddDatumValue<float>(datum, NumberParser::ToFloat(attributes[VALUE]), attributes);
 		}
 
 		void WorldParserHelper::HandleStringStart(WorldSharedData& sharedData, const AttributeMap& attributes)
@@ -140,23 +158,18 @@ namespace AnonymousEngine
 			ValidateRequiredAttributes(attributes);
 			if (attributes.ContainsKey(VECTOR_X) && attributes.ContainsKey(VECTOR_Y) && attributes.ContainsKey(VECTOR_Z) && attributes.ContainsKey(VECTOR_W))
 			{
-				Datum tempValue;
-				tempValue.SetType(Datum::DatumType::Vector);
-				std::string toParse = attributes[VECTOR_X];
-				toParse.append(",");
-				toParse.append(attributes[VECTOR_Y]).append(",");
-				toParse.append(attributes[VECTOR_Z]).append(",");
-				toParse.append(attributes[VECTOR_W]);
-				tempValue.Resize(1U);
-				tempValue.SetFromString(toParse);
+				glm::vec4 vector(NumberParser::ToFloat(attributes[VECTOR_X]), NumberParser::ToFloat(attributes[VECTOR_Y]),
+					NumberParser::ToFloat(attributes[VECTOR_Z]), NumberParser::ToFloat(attributes[VECTOR_W]));
 
 				if (sharedData.mMatrixName.empty())
 				{
 					Datum& datum = sharedData.mAttributed->Append(attributes[NAME]);
-					UpdateOrAddDatumValue(datum, tempValue.Get<glm::vec4>(), attributes);
+					UpdateOrAddDatumValue(datum, vector, attributes);
 				}
 				else
 				{
+					Datum tempValue;
+					tempValue = vector;
 					sharedData.mMatrixVectors.PushBack(tempValue);
 				}
 			}
@@ -12,7 +12,7 @@ namespace AnonymousEngine
 		class WorldParserHelper final : public IXmlParserHelper
 		{
 		public:
-			typedef AnonymousEngine::HashMap<std::string, std::string> AttributeMap;
+			typedef XmlAttributes AttributeMap;
 			typedef std::function<void(WorldSharedData& sharedData, const AttributeMap& attributes)> StartHandlerFunction;
 			typedef std::function<void(WorldSharedData& sharedData)> EndHandlerFunction;
 
@@ -34,6 +34,16 @@ namespace AnonymousEngine
 			 */
 			IXmlParserHelper* Create() override;
 
+			/** The tags handled by this helper
+			 *  @return The names of all the elements this helper has handlers for
+			 */
+			Vector<std::string> Tags() const override;
+			/** Only WorldSharedData is supported
+			 *  @param sharedData The shared data the parse master updates
+			 *  @return True if the shared data is a WorldSharedData
+			 */
+			bool IsSharedDataSupported(const SharedData& sharedData) const override;
+
 			/** Handles start element tags for all int, float, string, vec4, mat4 and scope
 			 *  @param sharedData The common shared data object which is modified by the helpers
 			 *  @param name The tag name
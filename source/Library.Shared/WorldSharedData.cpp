@@ -26,11 +26,13 @@ namespace AnonymousEngine
 		{
 			SharedData::Initialize();
 			delete mAttributed;
+			mAttributed = nullptr;
+			mElementStack.Clear();
 		}
 
 		Containers::World* WorldSharedData::ExtractWorld()
 		{
-			assert(mAttributed->Is(Containers::World::TypeIdClass()));
+			assert(mAttributed->Is<Containers::World>());
 			Containers::World* world = static_cast<Containers::World*>(mAttributed);
 			mAttributed = nullptr;
 			return world;
@@ -0,0 +1,67 @@
+#include "WorldSnapshot.h"
+#include "BinaryWorldWriter.h"
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		void WorldSnapshot::Write(const Scope& root, const std::string& filename)
+		{
+			BinaryWorldWriter writer(true);
+			writer.WriteToFile(root, filename);
+		}
+
+		WorldSnapshot::WorldSnapshot() :
+			mFile(), mRoot(nullptr)
+		{
+		}
+
+		WorldSnapshot::WorldSnapshot(const std::string& filename, BinaryWorldReader& reader) :
+			WorldSnapshot()
+		{
+			Open(filename, reader);
+		}
+
+		WorldSnapshot::~WorldSnapshot()
+		{
+			Close();
+		}
+
+		void WorldSnapshot::Open(const std::string& filename, BinaryWorldReader& reader)
+		{
+			Close();
+			mFile.Open(filename, MemoryMappedFile::Access::CopyOnWrite);
+			try
+			{
+				mRoot = reader.LoadInPlace(mFile.MutableData(), mFile.Size());
+			}
+			catch (...)
+			{
+				mFile.Close();
+				throw;
+			}
+		}
+
+		void WorldSnapshot::Close()
+		{
+			// the hierarchy points into the mapping, so it goes first
+			delete mRoot;
+			mRoot = nullptr;
+			mFile.Close();
+		}
+
+		bool WorldSnapshot::IsOpen() const
+		{
+			return mRoot != nullptr;
+		}
+
+		Scope& WorldSnapshot::Root() const
+		{
+			if (mRoot == nullptr)
+			{
+				throw std::runtime_error("No snapshot is open.");
+			}
+			return *mRoot;
+		}
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include "BinaryWorldReader.h"
+#include "MemoryMappedFile.h"
+#include "Scope.h"
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		/** A scope hierarchy used in place from a memory mapped binary world written with aligned payloads.
+		 *
+		 *  The file is mapped copy on write and the integer, float, vector and matrix datums of the hierarchy use its
+		 *  blocks as external storage, so opening a snapshot copies no numeric data and every process opening the same
+		 *  file shares its pages through the file cache until it writes to them. The file offsets are relative, so the
+		 *  mapping can live at any address. Strings and scopes are still built on load, and prescribed attributes are
+		 *  copied into the members they point at.
+		 *
+		 *  Snapshot datums are external, so they can be written but can't be resized, and they are only valid while the
+		 *  snapshot is open. Copies of a snapshot scope share that storage
+		 */
+		class WorldSnapshot final
+		{
+		public:
+			/** Write a scope hierarchy as a snapshot file
+			 *  @param root The scope to write
+			 *  @param filename The name of the file to create or overwrite
+			 *  @exception std::runtime_error Thrown if the file can't be written
+			 */
+			static void Write(const Scope& root, const std::string& filename);
+
+			/** Initialize a snapshot which has no file open
+			 */
+			WorldSnapshot();
+			/** Open a snapshot file
+			 *  @param filename The name of the snapshot file
+			 *  @param reader The reader which knows how to create the scope types of the snapshot
+			 *  @exception std::runtime_error Thrown if the file can't be mapped, is not a snapshot or is corrupt
+			 */
+			WorldSnapshot(const std::string& filename, BinaryWorldReader& reader);
+			/** Delete the hierarchy and unmap the file
+			 */
+			~WorldSnapshot();
+
+			// Delete move and copy semantics
+			WorldSnapshot(const WorldSnapshot&) = delete;
+			WorldSnapshot& operator=(const WorldSnapshot&) = delete;
+
+			/** Open a snapshot file, closing the current one first
+			 *  @param filename The name of the snapshot file
+			 *  @param reader The reader which knows how to create the scope types of the snapshot
+			 *  @exception std::runtime_error Thrown if the file can't be mapped, is not a snapshot or is corrupt
+			 */
+			void Open(const std::string& filename, BinaryWorldReader& reader);
+			/** Delete the hierarchy and unmap the file. Does nothing if no file is open
+			 */
+			void Close();
+
+			/** Whether a snapshot is open
+			 *  @return True if a snapshot is open
+			 */
+			bool IsOpen() const;
+			/** The root of the snapshot hierarchy. It is owned by the snapshot
+			 *  @return The root scope
+			 *  @exception std::runtime_error Thrown if no snapshot is open
+			 */
+			Scope& Root() const;
+		private:
+			// The mapped snapshot file. The hierarchy points into it
+			MemoryMappedFile mFile;
+			// The root of the hierarchy built over the file
+			Scope* mRoot;
+		};
+	}
+}
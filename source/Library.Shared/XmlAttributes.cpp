@@ -0,0 +1,138 @@
+#include "XmlAttributes.h"
+#include <cctype>
+#include <stdexcept>
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		#pragma region Iterator
+
+		XmlAttributes::Iterator::Iterator() :
+			mPosition(nullptr)
+		{
+		}
+
+		XmlAttributes::Iterator::Iterator(const XML_Char** position) :
+			mPosition(position)
+		{
+		}
+
+		XmlAttributes::Iterator& XmlAttributes::Iterator::operator++()
+		{
+			if (mPosition == nullptr || *mPosition == nullptr)
+			{
+				throw std::out_of_range("Iterator is past the last attribute.");
+			}
+			mPosition += 2;
+			return *this;
+		}
+
+		XmlAttributes::Iterator XmlAttributes::Iterator::operator++(int)
+		{
+			Iterator it = *this;
+			operator++();
+			return it;
+		}
+
+		XmlAttributes::Attribute XmlAttributes::Iterator::operator*() const
+		{
+			if (mPosition == nullptr || *mPosition == nullptr)
+			{
+				throw std::out_of_range("Iterator is past the last attribute.");
+			}
+			return Attribute(mPosition[0], mPosition[1]);
+		}
+
+		bool XmlAttributes::Iterator::operator==(const Iterator& rhs) const
+		{
+			return mPosition == rhs.mPosition;
+		}
+
+		bool XmlAttributes::Iterator::operator!=(const Iterator& rhs) const
+		{
+			return !(*this == rhs);
+		}
+
+		#pragma endregion
+
+		#pragma region XmlAttributes
+
+		XmlAttributes::XmlAttributes(const XML_Char** attributes) :
+			mAttributes(attributes)
+		{
+		}
+
+		bool XmlAttributes::ContainsKey(const std::string& name) const
+		{
+			return Find(name) != nullptr;
+		}
+
+		const XML_Char* XmlAttributes::operator[](const std::string& name) const
+		{
+			const XML_Char* value = Find(name);
+			if (value == nullptr)
+			{
+				throw std::invalid_argument("Key not found");
+			}
+			return value;
+		}
+
+		const XML_Char* XmlAttributes::Find(const std::string& name) const
+		{
+			for (const XML_Char** position = mAttributes; *position != nullptr; position += 2)
+			{
+				if (NameEquals(position[0], name))
+				{
+					return position[1];
+				}
+			}
+			return nullptr;
+		}
+
+		std::uint32_t XmlAttributes::Size() const
+		{
+			std::uint32_t size = 0;
+			for (const XML_Char** position = mAttributes; *position != nullptr; position += 2)
+			{
+				++size;
+			}
+			return size;
+		}
+
+		bool XmlAttributes::IsEmpty() const
+		{
+			return *mAttributes == nullptr;
+		}
+
+		XmlAttributes::Iterator XmlAttributes::begin() const
+		{
+			return Iterator(mAttributes);
+		}
+
+		XmlAttributes::Iterator XmlAttributes::end() const
+		{
+			const XML_Char** position = mAttributes;
+			while (*position != nullptr)
+			{
+				position += 2;
+			}
+			return Iterator(position);
+		}
+
+		bool XmlAttributes::NameEquals(const XML_Char* attributeName, const std::string& name)
+		{
+			std::size_t index = 0;
+			for (; attributeName[index] != '\0'; ++index)
+			{
+				if (index == name.size() || std::tolower(static_cast<unsigned char>(attributeName[index])) != std::tolower(static_cast<unsigned char>(name[index])))
+				{
+					return false;
+				}
+			}
+			return index == name.size();
+		}
+
+		#pragma endregion
+	}
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include "expat.h"
+
+namespace AnonymousEngine
+{
+	namespace Parsers
+	{
+		/** A read only view over the attribute array expat hands to its start element handler. Nothing is copied, names
+		 *  are matched case insensitively and the view is only valid for the duration of the start element callback
+		 */
+		class XmlAttributes final
+		{
+		public:
+			/** An attribute name and value pair
+			 */
+			typedef std::pair<const XML_Char*, const XML_Char*> Attribute;
+
+			/** Walks the attributes in the order they appear in the document
+			 */
+			class Iterator final
+			{
+			public:
+				/** Initialize an iterator which does not point to any attribute
+				 */
+				Iterator();
+
+				/** Move to the next attribute
+				 *  @return A reference to this iterator after moving
+				 */
+				Iterator& operator++();
+				/** Move to the next attribute
+				 *  @return A copy of this iterator before moving
+				 */
+				Iterator operator++(int);
+
+				/** Get the attribute this iterator points to
+				 *  @return The name and value of the attribute
+				 */
+				Attribute operator*() const;
+
+				/** Whether two iterators point to the same attribute
+				 *  @param rhs The iterator to compare against
+				 *  @return True if both point to the same attribute
+				 */
+				bool operator==(const Iterator& rhs) const;
+				/** Whether two iterators point to different attributes
+				 *  @param rhs The iterator to compare against
+				 *  @return True if they point to different attributes
+				 */
+				bool operator!=(const Iterator& rhs) const;
+			private:
+				explicit Iterator(const XML_Char** position);
+
+				// Points to the name of the current attribute, followed by its value
+				const XML_Char** mPosition;
+
+				friend class XmlAttributes;
+			};
+
+			/** Initialize a view over a null terminated array of alternating attribute names and values
+			 *  @param attributes The attribute array from expat
+			 */
+			explicit XmlAttributes(const XML_Char** attributes);
+
+			/** Whether an attribute with the given name exists
+			 *  @param name The name of the attribute, in any case
+			 *  @return True if the element has the attribute
+			 */
+			bool ContainsKey(const std::string& name) const;
+			/** Get the value of an attribute
+			 *  @param name The name of the attribute, in any case
+			 *  @return The value of the attribute
+			 *  @exception std::invalid_argument Thrown if the element doesn't have the attribute
+			 */
+			const XML_Char* operator[](const std::string& name) const;
+			/** Get the value of an attribute if it exists
+			 *  @param name The name of the attribute, in any case
+			 *  @return The value of the attribute, or null if the element doesn't have it
+			 */
+			const XML_Char* Find(const std::string& name) const;
+
+			/** The number of attributes
+			 *  @return The number of attributes of the element
+			 */
+			std::uint32_t Size() const;
+			/** Whether the element has no attributes
+			 *  @return True if there are no attributes
+			 */
+			bool IsEmpty() const;
+
+			/** Get an iterator to the first attribute
+			 *  @return An iterator to the first attribute
+			 */
+			Iterator begin() const;
+			/** Get an iterator past the last attribute
+			 *  @return An iterator past the last attribute
+			 */
+			Iterator end() const;
+		private:
+			// Compares an attribute name with a name, ignoring the case of both
+			static bool NameEquals(const XML_Char* attributeName, const std::string& name);
+
+			// The null terminated attribute array
+			const XML_Char** mAttributes;
+		};
+	}
+}
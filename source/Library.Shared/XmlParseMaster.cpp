@@ -2,9 +2,10 @@
 #include <algorithm>
 #include <cctype>
 #include <fstream>
+#include <limits>
 #include "expat.h"
 #include "IXmlParseHelper.h"
-#include "HashMap.h"
+#include "MemoryMappedFile.h"
 #include "SharedData.h"
 
 namespace AnonymousEngine
@@ -13,8 +14,11 @@ namespace AnonymousEngine
 	{
 		const std::string XmlParseMaster::UTF8_ENCODING = "UTF-8";
 
+		// The largest buffer length expat can be handed
+		static const std::uint32_t MaxChunkSize = static_cast<std::uint32_t>(std::numeric_limits<int>::max());
+
 		XmlParseMaster::XmlParseMaster(SharedData& sharedData) :
-			mParser(XML_ParserCreate(UTF8_ENCODING.c_str())), mCurrentElementHelper(nullptr), mSharedData(&sharedData), mIsClone(false)
+			mParser(XML_ParserCreate(UTF8_ENCODING.c_str())), mHelpers(), mTagHelpers(), mFallbackHelpers(), mCurrentElementHelper(nullptr), mTagName(), mSharedData(&sharedData), mIsClone(false)
 		{
 		}
 
@@ -58,6 +62,7 @@ namespace AnonymousEngine
 				}
 			}
 			mHelpers.PushBack(&helper);
+			BuildDispatchTable();
 		}
 
 		void XmlParseMaster::RemoveHelper(IXmlParserHelper& helper)
@@ -67,6 +72,7 @@ namespace AnonymousEngine
 				throw std::runtime_error("Can't remove helpers from a cloned parser");
 			}
 			mHelpers.Remove(&helper);
+			BuildDispatchTable();
 		}
 
 		void XmlParseMaster::Parse(const std::string& buffer, bool isFirstChunk, bool isLastChunk)
@@ -76,23 +82,63 @@ namespace AnonymousEngine
 				Reset();
 			}
 
-			XML_Status status = XML_Parse(mParser, buffer.c_str(), static_cast<std::uint32_t>(buffer.size()), isLastChunk);
-			if (status != XML_STATUS_OK)
-			{
-				throw std::runtime_error(XML_ErrorString(XML_GetErrorCode(mParser)));
-			}
+			ParseBuffer(buffer.c_str(), buffer.size(), isLastChunk);
 		}
 
-		void XmlParseMaster::ParseFromFile(const std::string& filename)
+		void XmlParseMaster::ParseFromFile(const std::string& filename, std::uint32_t chunkSize)
 		{
 			mFilename = filename;
-			std::ifstream in(filename);
+			std::ifstream in(filename, std::ios::binary);
 			if (!in.is_open())
 			{
 				throw std::runtime_error(std::string("Unable to read xml file. filename = ").append(filename));
 			}
-			std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
-			Parse(contents);
+			ParseFromStream(in, chunkSize);
+		}
+
+		void XmlParseMaster::ParseFromStream(std::istream& in, std::uint32_t chunkSize)
+		{
+			if (chunkSize == 0)
+			{
+				throw std::invalid_argument("Chunk size should be greater than zero.");
+			}
+
+			// expat takes buffer lengths as int, so larger chunks are clamped before anything is handed to it
+			const std::uint32_t readSize = std::min(chunkSize, MaxChunkSize);
+
+			Reset();
+			bool isLastChunk = false;
+			while (!isLastChunk)
+			{
+				// read directly into expat's buffer to avoid an intermediate copy
+				char* buffer = static_cast<char*>(XML_GetBuffer(mParser, static_cast<int>(readSize)));
+				if (buffer == nullptr)
+				{
+					throw std::runtime_error("Unable to allocate the xml parse buffer.");
+				}
+
+				in.read(buffer, readSize);
+				if (in.bad())
+				{
+					throw std::runtime_error("Unable to read the xml stream.");
+				}
+				isLastChunk = in.eof();
+
+				const std::uint32_t readLength = static_cast<std::uint32_t>(in.gcount());
+				XML_Status status = XML_ParseBuffer(mParser, static_cast<int>(readLength), isLastChunk);
+				if (status != XML_STATUS_OK)
+				{
+					throw std::runtime_error(XML_ErrorString(XML_GetErrorCode(mParser)));
+				}
+			}
+		}
+
+		void XmlParseMaster::ParseFromMappedFile(const std::string& filename)
+		{
+			mFilename = filename;
+			MemoryMappedFile file(filename);
+			Reset();
+			ParseBuffer(file.Data(), file.Size(), true);
 		}
 
 		std::string XmlParseMaster::GetFileName() const
@@ -110,6 +156,7 @@ namespace AnonymousEngine
 			this->mSharedData = &sharedData;
 			sharedData.mParser = this;
 			XML_SetUserData(mParser, &sharedData);
+			BuildDispatchTable();
 		}
 
 		void XmlParseMaster::Reset()
@@ -133,6 +180,48 @@ namespace AnonymousEngine
 			}
 		}
 
+		void XmlParseMaster::BuildDispatchTable()
+		{
+			mTagHelpers.Clear();
+			mFallbackHelpers.Clear();
+			for (auto& helper : mHelpers)
+			{
+				if (!helper->IsSharedDataSupported(*mSharedData))
+				{
+					continue;
+				}
+
+				Vector<std::string> tags = helper->Tags();
+				if (tags.IsEmpty())
+				{
+					mFallbackHelpers.PushBack(helper);
+				}
+				for (const auto& tag : tags)
+				{
+					// the first helper added keeps a shared tag, as it would have won the walk down the helper chain
+					mTagHelpers.Insert(std::make_pair(tag, helper));
+				}
+			}
+		}
+
+		void XmlParseMaster::ParseBuffer(const char* buffer, std::uint64_t size, bool isLastChunk)
+		{
+			const std::uint64_t maxLength = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+			do
+			{
+				int length = static_cast<int>(std::min(size, maxLength));
+				bool isFinal = isLastChunk && (static_cast<std::uint64_t>(length) == size);
+
+				XML_Status status = XML_Parse(mParser, buffer, length, isFinal);
+				if (status != XML_STATUS_OK)
+				{
+					throw std::runtime_error(XML_ErrorString(XML_GetErrorCode(mParser)));
+				}
+				buffer += length;
+				size -= length;
+			} while (size > 0);
+		}
+
 		void XmlParseMaster::StartElementHandler(void *userData, const XML_Char *name, const XML_Char **attributes)
 		{
 			SharedData* sharedData = reinterpret_cast<SharedData*>(userData);
@@ -140,21 +229,21 @@ namespace AnonymousEngine
 
 			sharedData->IncrementDepth();
 
-			// prepare name and attribute data for helpers
-			HashMap<std::string, std::string> attributeMap;
-			for (std::uint32_t i = 0; attributes[i] != nullptr; i += 2)
+			// lower case the tag once for all helpers, attributes are matched in place
+			parseMaster->mTagName.assign(name);
+			std::transform(parseMaster->mTagName.begin(), parseMaster->mTagName.end(), parseMaster->mTagName.begin(), ::tolower);
+			XmlAttributes attributeView(attributes);
+
+			// the owner of the tag gets the element first, the helpers which own no tags get whatever is left
+			auto it = parseMaster->mTagHelpers.Find(parseMaster->mTagName);
+			if (it != parseMaster->mTagHelpers.end() && it->second->StartElementHandler(*sharedData, parseMaster->mTagName, attributeView))
 			{
-				std::string attribute(attributes[i]);
-				std::transform(attribute.begin(), attribute.end(), attribute.begin(), ::tolower);
-				attributeMap[attribute] = attributes[i + 1];
+				parseMaster->mCurrentElementHelper = it->second;
+				return;
 			}
-
-			// walk the helper chain to handle the responsibility
-			for (auto& helper : parseMaster->mHelpers)
+			for (auto& helper : parseMaster->mFallbackHelpers)
 			{
-				std::string tagName(name);
-				std::transform(tagName.begin(), tagName.end(), tagName.begin(), ::tolower);
-				if (helper->StartElementHandler(*sharedData, tagName, attributeMap))
+				if (helper->StartElementHandler(*sharedData, parseMaster->mTagName, attributeView))
 				{
 					parseMaster->mCurrentElementHelper = helper;
 					break;
@@ -166,14 +255,24 @@ namespace AnonymousEngine
 		{
 			SharedData* sharedData = reinterpret_cast<SharedData*>(userData);
 			XmlParseMaster* parseMaster = sharedData->GetXmlParseMaster();
-			for (auto& helper : parseMaster->mHelpers)
+
+			parseMaster->mTagName.assign(name);
+			std::transform(parseMaster->mTagName.begin(), parseMaster->mTagName.end(), parseMaster->mTagName.begin(), ::tolower);
+
+			auto it = parseMaster->mTagHelpers.Find(parseMaster->mTagName);
+			if (it != parseMaster->mTagHelpers.end() && it->second->EndElementHandler(*sharedData, parseMaster->mTagName))
 			{
-				std::string tagName(name);
-				std::transform(tagName.begin(), tagName.end(), tagName.begin(), ::tolower);
-				if (helper->EndElementHandler(*sharedData, tagName))
+				parseMaster->mCurrentElementHelper = nullptr;
+			}
+			else
+			{
+				for (auto& helper : parseMaster->mFallbackHelpers)
 				{
-					parseMaster->mCurrentElementHelper = nullptr;
-					break;
+					if (helper->EndElementHandler(*sharedData, parseMaster->mTagName))
+					{
+						parseMaster->mCurrentElementHelper = nullptr;
+						break;
+					}
 				}
 			}
 			sharedData->DecrementDepth();
@@ -183,18 +282,15 @@ namespace AnonymousEngine
 		{
 			SharedData* sharedData = reinterpret_cast<SharedData*>(userData);
 			XmlParseMaster* parseMaster = sharedData->GetXmlParseMaster();
-			std::string bufferData = TrimString(std::string(buffer, length));
-			if (parseMaster->mCurrentElementHelper != nullptr && bufferData.size() > 0)
+			if (parseMaster->mCurrentElementHelper != nullptr && !IsWhitespace(buffer, length))
 			{
-				parseMaster->mCurrentElementHelper->CharDataHandler(*sharedData, std::string(buffer, length));
+				parseMaster->mCurrentElementHelper->CharDataHandler(*sharedData, buffer, static_cast<std::uint32_t>(length));
 			}
 		}
 
-		std::string XmlParseMaster::TrimString(const std::string& string)
+		bool XmlParseMaster::IsWhitespace(const XML_Char* buffer, int length)
 		{
-			auto front = std::find_if_not(string.begin(), string.end(), [] (std::int32_t character) { return std::isspace(character); });
-			auto back = std::find_if_not(string.rbegin(), string.rend(), [](std::int32_t character) { return std::isspace(character); }).base();
-			return ((back <= front) ? std::string() : std::string(front, back));
+			return std::all_of(buffer, buffer + length, [](XML_Char character) { return std::isspace(static_cast<unsigned char>(character)) != 0; });
 		}
 	}
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <istream>
 #include "expat.h"
+#include "HashMap.h"
 #include "IXmlParseHelper.h"
 #include "Vector.h"
 #include "RTTI.h"
@@ -16,6 +18,10 @@ namespace AnonymousEngine
 		class XmlParseMaster final
 		{
 		public:
+			/** The number of bytes streamed into the parser at a time by default
+			 */
+			static const std::uint32_t DefaultChunkSize = 64U * 1024U;
+
 			/** Initializes the parser
 			 */
 			XmlParseMaster(SharedData& sharedData);
@@ -35,7 +41,8 @@ namespace AnonymousEngine
 			*/
 			XmlParseMaster& operator=(const XmlParseMaster& rhs) = delete;
 			
-			/** Adds a helper to the list of available helpers in the parser
+			/** Adds a helper to the list of available helpers in the parser. Elements named in the helper's tags are
+			 *  dispatched straight to it, unless a helper added earlier already owns the same tag
 			 *  @param helper The new helper to add to the parser
 			 */
 			void AddHelper(IXmlParserHelper& helper);
@@ -50,10 +57,24 @@ namespace AnonymousEngine
 			 *  @param isLastChunk Whether the current data is the last chunk from the xml
 			 */
 			void Parse(const std::string& buffer, bool isFirstChunk = true, bool isLastChunk = true);
-			/** Parse an xml from a file
+			/** Parse an xml from a file. The file is streamed into the parser in chunks, so memory use stays bounded
+			 *  regardless of the size of the file
+			 *  @param filename The name of the xml file
+			 *  @param chunkSize The number of bytes read and parsed at a time
+			 */
+			void ParseFromFile(const std::string& filename, std::uint32_t chunkSize = DefaultChunkSize);
+			/** Parse an xml from a stream, reading it in chunks straight into the parser's buffer
+			 *  @param in The stream to read the xml from
+			 *  @param chunkSize The number of bytes read and parsed at a time. Sizes beyond what fits an int are clamped
+			 *  @exception std::invalid_argument Thrown if the chunk size is zero
+			 */
+			void ParseFromStream(std::istream& in, std::uint32_t chunkSize = DefaultChunkSize);
+			/** Parse an xml file by mapping it into memory and handing the mapped pages to the parser directly, without
+			 *  copying the file into a string or through stream buffers. Helpers see exactly the same callbacks as with
+			 *  ParseFromFile
 			 *  @param filename The name of the xml file
 			 */
-			void ParseFromFile(const std::string& filename);
+			void ParseFromMappedFile(const std::string& filename);
 			
 			/** Get the current file name
 			 *  @return The current file being processed
@@ -74,15 +95,25 @@ namespace AnonymousEngine
 
 		private:
 			void Initialize();
+			// Rebuild the tag to helper table from the helpers which support the current shared data
+			void BuildDispatchTable();
+			// Feed a buffer of any size to expat, which only takes int sized lengths
+			void ParseBuffer(const char* buffer, std::uint64_t size, bool isLastChunk);
 
 			static void StartElementHandler(void* userData, const XML_Char* name, const XML_Char** attributes);
 			static void EndElementHandler(void* userData, const XML_Char* name);
 			static void CharDataHandler(void* userData, const XML_Char* buffer, int length);
-			static std::string TrimString(const std::string& string);
+			static bool IsWhitespace(const XML_Char* buffer, int length);
 
 			XML_Parser mParser;
 			Vector<IXmlParserHelper*> mHelpers;
+			// Lower case tag name to the helper which owns it
+			HashMap<std::string, IXmlParserHelper*> mTagHelpers;
+			// Helpers which own no tags, offered every element that no other helper owns
+			Vector<IXmlParserHelper*> mFallbackHelpers;
 			IXmlParserHelper* mCurrentElementHelper;
+			// Lower case name of the current element, reused across elements so its storage is allocated only once
+			std::string mTagName;
 			std::string mFilename;
 			SharedData* mSharedData;
 
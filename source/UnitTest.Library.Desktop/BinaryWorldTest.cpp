@@ -0,0 +1,400 @@
+#include "Pch.h"
+#include <cstdio>
+#include <sstream>
+#include "ActionList.h"
+#include "AttributedFoo.h"
+#include "BinaryWorldReader.h"
+#include "BinaryWorldWriter.h"
+#include "CreateAction.h"
+#include "DestroyAction.h"
+#include "Entity.h"
+#include "HeadlessSimulation.h"
+#include "Sector.h"
+#include "SetValue.h"
+#include "Switch.h"
+#include "TestClassHelper.h"
+#include "World.h"
+#include "WorldSnapshot.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTestLibraryDesktop
+{
+	using namespace AnonymousEngine;
+	using namespace AnonymousEngine::Containers;
+	using namespace AnonymousEngine::Parsers;
+
+	TEST_CLASS(BinaryWorldTest)
+	{
+	public:
+		TEST_METHOD(TestWorldRoundTrip)
+		{
+			EntityFactory entityFactory;
+			ActionListFactory actionFactory;
+			CreateActionFactory createActionFactory;
+			DestroyActionFactory destroyActionFactory;
+			SetValueFactory setValueFactory;
+			SwitchFactory switchFactory;
+
+			World* world = HeadlessSimulation::LoadWorld(WorldXmlFile);
+			std::ostringstream out(std::ios::binary);
+			BinaryWorldWriter writer;
+			writer.Write(*world, out);
+
+			BinaryWorldReader reader;
+			Scope* root = reader.Load(out.str());
+			Assert::IsTrue(root->Is<World>());
+			World* loaded = static_cast<World*>(root);
+			Assert::AreEqual(world->ToString(), loaded->ToString());
+			Assert::AreEqual(world->Name(), loaded->Name());
+
+			// the hierarchy is made of the original classes, with prescribed attributes bound to their members
+			Assert::AreEqual(2U, loaded->Sectors().Size());
+			Sector& sector = static_cast<Sector&>(loaded->Sectors().Get<Scope>(0));
+			Assert::IsTrue(sector.Is<Sector>());
+			Assert::AreEqual(std::string("Whiterun"), sector.Name());
+			Assert::IsTrue(&sector.GetWorld() == loaded);
+			Entity& entity = static_cast<Entity&>(sector.Entities().Get<Scope>(0));
+			Assert::IsTrue(entity.Is<Entity>());
+			Assert::AreEqual(std::string("Bannered Mare"), entity.Name());
+			Assert::IsTrue(entity["this"] == static_cast<RTTI*>(&entity));
+			Assert::IsTrue(entity.Actions().Get<Scope>(2).Is<ActionList>());
+			Assert::IsTrue(loaded->Actions().Get<Scope>(2).Is<Switch>());
+			Assert::AreEqual(10, entity["Beds"].Get<std::int32_t>());
+			Entity& original = static_cast<Entity&>(static_cast<Sector&>(world->Sectors().Get<Scope>(0)).Entities().Get<Scope>(0));
+			Assert::IsTrue(entity["Transform"] == original["Transform"]);
+
+			// writing the loaded world again gives the same bytes
+			std::ostringstream again(std::ios::binary);
+			writer.Write(*loaded, again);
+			Assert::AreEqual(out.str(), again.str());
+
+			delete loaded;
+			delete world;
+		}
+
+		TEST_METHOD(TestScopeRoundTrip)
+		{
+			Scope scope;
+			scope["Integers"] = 1;
+			scope["Integers"].PushBack(-2);
+			scope["Integers"].PushBack(mHelper.GetRandomInt32());
+			scope["Float"] = mHelper.GetRandomFloat();
+			scope["Strings"] = std::string("first");
+			scope["Strings"].PushBack(std::string());
+			scope["Strings"].PushBack(std::string("first"));
+			scope["Vector"] = glm::vec4(1.0f, 2.0f, 3.0f, 4.0f);
+			scope["Matrix"] = glm::mat4(mHelper.GetRandomFloat());
+			scope.Append("Empty");
+			Scope& child = scope.AppendScope("Children");
+			child["Value"] = 10;
+			scope.AppendScope("Children").AppendScope("Grandchild")["Name"] = std::string("leaf");
+
+			std::ostringstream out(std::ios::binary);
+			BinaryWorldWriter writer;
+			writer.Write(scope, out);
+			BinaryWorldReader reader;
+			Scope* loaded = reader.Load(out.str());
+			Assert::IsTrue(*loaded == scope);
+			Assert::AreEqual(scope.ToString(), loaded->ToString());
+			Assert::AreEqual(scope.Size(), loaded->Size());
+			for (std::uint32_t index = 0; index < scope.Size(); ++index)
+			{
+				Assert::AreEqual(scope.GetKey(index), loaded->GetKey(index));
+			}
+			Assert::IsTrue((*loaded)["Children"].Get<Scope>(1)["Grandchild"].Get<Scope>().GetParent() == &(*loaded)["Children"].Get<Scope>(1));
+			delete loaded;
+		}
+
+		TEST_METHOD(TestRegisteredTypes)
+		{
+			AttributedFoo foo;
+			foo.mInt = 7;
+			foo.mString = "seven";
+			foo.mVec4 = glm::vec4(7.0f);
+			foo["mIntArray"].Set(70, 3);
+			foo["mStringArray"].Set(std::string("seventy"), 4);
+			(*foo.mNestedScope)["Inner"] = 77;
+			foo["Auxiliary"] = 1.5f;
+
+			std::ostringstream out(std::ios::binary);
+			BinaryWorldWriter writer;
+			writer.Write(foo, out);
+
+			BinaryWorldReader reader;
+			Assert::ExpectException<std::runtime_error>([&reader, &out] { reader.Load(out.str()); });
+
+			reader.RegisterType(AttributedFoo::TypeName(), []() { return new AttributedFoo(); });
+			Scope* root = reader.Load(out.str());
+			AttributedFoo* loaded = root->As<AttributedFoo>();
+			Assert::IsNotNull(loaded);
+			Assert::AreEqual(7, loaded->mInt);
+			Assert::AreEqual(std::string("seven"), loaded->mString);
+			Assert::IsTrue(loaded->mVec4 == glm::vec4(7.0f));
+			Assert::AreEqual(70, (*loaded)["mIntArray"].Get<std::int32_t>(3));
+			Assert::AreEqual(std::string("seventy"), (*loaded)["mStringArray"].Get<std::string>(4));
+			Assert::AreEqual(1.5f, (*loaded)["Auxiliary"].Get<float>());
+
+			// the nested scope made by the constructor is filled instead of getting a sibling
+			Assert::AreEqual(1U, (*loaded)["mNestedScope"].Size());
+			Assert::AreEqual(77, (*loaded->mNestedScope)["Inner"].Get<std::int32_t>());
+			Assert::IsTrue(*loaded == foo);
+			delete root;
+		}
+
+		TEST_METHOD(TestFiles)
+		{
+			EntityFactory entityFactory;
+			ActionListFactory actionFactory;
+			CreateActionFactory createActionFactory;
+			DestroyActionFactory destroyActionFactory;
+			SetValueFactory setValueFactory;
+			SwitchFactory switchFactory;
+
+			World* world = HeadlessSimulation::LoadWorld(WorldXmlFile);
+			BinaryWorldWriter writer;
+			writer.WriteToFile(*world, BinaryWorldFile);
+			BinaryWorldReader reader;
+			World* loaded = reader.LoadWorldFromFile(BinaryWorldFile);
+			Assert::AreEqual(world->ToString(), loaded->ToString());
+			delete loaded;
+			delete world;
+
+			Scope scope;
+			scope["Value"] = 1;
+			writer.WriteToFile(scope, BinaryWorldFile);
+			Assert::ExpectException<std::runtime_error>([&reader] { reader.LoadWorldFromFile(BinaryWorldFile); });
+			Scope* root = reader.LoadFromFile(BinaryWorldFile);
+			Assert::IsTrue(*root == scope);
+			delete root;
+
+			Assert::ExpectException<std::runtime_error>([&reader, this] { reader.LoadFromFile(mHelper.GetRandomString()); });
+			Assert::ExpectException<std::runtime_error>([&writer, &scope] { writer.WriteToFile(scope, "MissingDirectory/world.bin"); });
+			std::remove(BinaryWorldFile.c_str());
+		}
+
+		TEST_METHOD(TestCorruptData)
+		{
+			Scope scope;
+			scope["Integers"] = 1;
+			scope["Strings"] = std::string("value");
+			scope.AppendScope("Child")["Float"] = 1.0f;
+			std::ostringstream out(std::ios::binary);
+			BinaryWorldWriter writer;
+			writer.Write(scope, out);
+			std::string data = out.str();
+
+			// every truncation fails cleanly
+			BinaryWorldReader reader;
+			for (std::uint32_t length = 0; length < data.size(); ++length)
+			{
+				std::string truncated = data.substr(0, length);
+				Assert::ExpectException<std::runtime_error>([&reader, &truncated] { reader.Load(truncated); });
+			}
+
+			std::string badMagic = data;
+			badMagic[0] = 'X';
+			Assert::ExpectException<std::runtime_error>([&reader, &badMagic] { reader.Load(badMagic); });
+			std::string badVersion = data;
+			badVersion[4] = static_cast<char>(0xFF);
+			Assert::ExpectException<std::runtime_error>([&reader, &badVersion] { reader.Load(badVersion); });
+			std::string trailing = data + "x";
+			Assert::ExpectException<std::runtime_error>([&reader, &trailing] { reader.Load(trailing); });
+
+			Scope* loaded = reader.Load(data);
+			Assert::IsTrue(*loaded == scope);
+			delete loaded;
+		}
+
+		TEST_METHOD(TestSnapshot)
+		{
+			EntityFactory entityFactory;
+			ActionListFactory actionFactory;
+			CreateActionFactory createActionFactory;
+			DestroyActionFactory destroyActionFactory;
+			SetValueFactory setValueFactory;
+			SwitchFactory switchFactory;
+
+			World* world = HeadlessSimulation::LoadWorld(WorldXmlFile);
+			WorldSnapshot::Write(*world, BinaryWorldFile);
+
+			BinaryWorldReader reader;
+			WorldSnapshot snapshot;
+			Assert::IsFalse(snapshot.IsOpen());
+			Assert::ExpectException<std::runtime_error>([&snapshot] { snapshot.Root(); });
+			snapshot.Open(BinaryWorldFile, reader);
+			Assert::IsTrue(snapshot.IsOpen());
+			Assert::IsTrue(snapshot.Root().Is<World>());
+			Assert::AreEqual(world->ToString(), snapshot.Root().ToString());
+
+			// numeric datums live in the mapped file, aligned for their type
+			Sector& sector = static_cast<Sector&>(static_cast<World&>(snapshot.Root()).Sectors().Get<Scope>(0));
+			Entity& entity = static_cast<Entity&>(sector.Entities().Get<Scope>(0));
+			Datum& beds = entity["Beds"];
+			Datum& transform = entity["Transform"];
+			Assert::IsTrue(beds.IsExternal());
+			Assert::IsTrue(transform.IsExternal());
+			Assert::AreEqual(0U, static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&transform.Get<glm::mat4>()) % BinaryWorldWriter::PayloadAlignment));
+			Assert::AreEqual(std::string("Bannered Mare"), entity.Name());
+			Assert::ExpectException<std::runtime_error>([&beds] { beds.PushBack(1); });
+
+			// writes stay private to the process, the file keeps its values
+			beds = 20;
+			Assert::AreEqual(20, static_cast<Entity&>(static_cast<Sector&>(static_cast<World&>(snapshot.Root()).Sectors().Get<Scope>(0)).Entities().Get<Scope>(0))["Beds"].Get<std::int32_t>());
+			snapshot.Open(BinaryWorldFile, reader);
+			Assert::AreEqual(world->ToString(), snapshot.Root().ToString());
+			snapshot.Close();
+			Assert::IsFalse(snapshot.IsOpen());
+
+			// a snapshot is also a regular binary world, but an unaligned binary world is not a snapshot
+			World* loaded = reader.LoadWorldFromFile(BinaryWorldFile);
+			Assert::AreEqual(world->ToString(), loaded->ToString());
+			Assert::IsFalse((*loaded)["Sectors"].Get<Scope>(0)["Entities"].Get<Scope>(0)["Beds"].IsExternal());
+			delete loaded;
+			BinaryWorldWriter writer;
+			writer.WriteToFile(*world, BinaryWorldFile);
+			Assert::ExpectException<std::runtime_error>([&snapshot, &reader] { snapshot.Open(BinaryWorldFile, reader); });
+			Assert::IsFalse(snapshot.IsOpen());
+
+			delete world;
+			std::remove(BinaryWorldFile.c_str());
+		}
+
+		TEST_METHOD(TestDelta)
+		{
+			EntityFactory entityFactory;
+			ActionListFactory actionFactory;
+			CreateActionFactory createActionFactory;
+			DestroyActionFactory destroyActionFactory;
+			SetValueFactory setValueFactory;
+			SwitchFactory switchFactory;
+
+			World* world = HeadlessSimulation::LoadWorld(WorldXmlFile);
+			std::ostringstream base(std::ios::binary);
+			BinaryWorldWriter writer;
+			writer.Write(*world, base);
+			writer.Checkpoint(*world);
+
+			// nothing changed, nothing is written
+			std::ostringstream empty(std::ios::binary);
+			writer.WriteDelta(*world, empty);
+			BinaryWorldReader reader;
+			World* copy = static_cast<World*>(reader.Load(base.str()));
+			reader.ApplyDelta(*copy, empty.str());
+			Assert::AreEqual(world->ToString(), copy->ToString());
+
+			// values written through datums, members written directly and new scopes are all picked up
+			Sector& sector = static_cast<Sector&>(world->Sectors().Get<Scope>(0));
+			Entity& entity = static_cast<Entity&>(sector.Entities().Get<Scope>(0));
+			entity["Beds"] = 12;
+			entity["Transform"].Get<glm::mat4>()[3][0] = 5.0f;
+			entity.SetName("Drunken Huntsman");
+			sector.CreateEntity("Breezehome", "Entity")["Owner"] = std::string("Dragonborn");
+			world->AppendScope("Weather")["Rain"] = 0.5f;
+			std::ostringstream delta(std::ios::binary);
+			writer.WriteDelta(*world, delta);
+			Assert::IsTrue(delta.str().size() < base.str().size() / 2);
+			reader.ApplyDelta(*copy, delta.str());
+			Assert::AreEqual(world->ToString(), copy->ToString());
+			Entity& copyEntity = static_cast<Entity&>(static_cast<Sector&>(copy->Sectors().Get<Scope>(0)).Entities().Get<Scope>(0));
+			Assert::AreEqual(std::string("Drunken Huntsman"), copyEntity.Name());
+			Assert::IsTrue(copyEntity["Transform"] == entity["Transform"]);
+
+			// each delta is relative to the one before it
+			entity["Beds"] = 14;
+			writer.WriteDeltaToFile(*world, BinaryWorldFile);
+			reader.ApplyDeltaFromFile(*copy, BinaryWorldFile);
+			Assert::AreEqual(14, copyEntity["Beds"].Get<std::int32_t>());
+			Assert::AreEqual(world->ToString(), copy->ToString());
+
+			// a changed list of scopes replaces children of another type and drops the extra ones
+			Scope replaced;
+			replaced.AppendScope("Children")["Value"] = 1;
+			replaced.AppendScope("Children")["Value"] = 2;
+			writer.Checkpoint(replaced);
+			Scope replacedCopy;
+			reader.RegisterType(AttributedFoo::TypeName(), []() { return new AttributedFoo(); });
+			replacedCopy.Adopt(*new AttributedFoo(), "Children");
+			replacedCopy.AppendScope("Children");
+			replacedCopy.AppendScope("Children");
+			delete &replaced["Children"].Get<Scope>(1);
+			std::ostringstream shrunk(std::ios::binary);
+			writer.WriteDelta(replaced, shrunk);
+			reader.ApplyDelta(replacedCopy, shrunk.str());
+			Assert::AreEqual(1U, replacedCopy["Children"].Size());
+			Assert::IsFalse(replacedCopy["Children"].Get<Scope>().Is<AttributedFoo>());
+			Assert::IsTrue(replacedCopy == replaced);
+
+			// deltas and whole worlds can't stand in for each other
+			Assert::ExpectException<std::runtime_error>([&reader, &delta] { reader.Load(delta.str()); });
+			Assert::ExpectException<std::runtime_error>([&reader, &base, copy] { reader.ApplyDelta(*copy, base.str()); });
+			Scope unrelated;
+			Assert::ExpectException<std::runtime_error>([&reader, &delta, &unrelated] { reader.ApplyDelta(unrelated, delta.str()); });
+
+			delete copy;
+			delete world;
+			std::remove(BinaryWorldFile.c_str());
+		}
+
+		TEST_METHOD(TestDeltaReusedScopes)
+		{
+			Scope scope;
+			Scope& first = scope.AppendScope("Children");
+			first["Value"] = 1;
+			scope.AppendScope("Children")["Value"] = 2;
+			std::ostringstream base(std::ios::binary);
+			BinaryWorldWriter writer;
+			writer.Write(scope, base);
+			writer.Checkpoint(scope);
+			BinaryWorldReader reader;
+			Scope* copy = reader.Load(base.str());
+
+			// a child orphaned and adopted again moves to the end of its list
+			first.Orphan();
+			scope.Adopt(first, "Children");
+			first["Value"] = 3;
+			std::ostringstream readopted(std::ios::binary);
+			writer.WriteDelta(scope, readopted);
+			reader.ApplyDelta(*copy, readopted.str());
+			Assert::IsTrue(*copy == scope);
+
+			// a child destroyed and replaced by a new one, which may well take its address, isn't mistaken for it
+			delete &scope["Children"].Get<Scope>(0);
+			scope.AppendScope("Children")["Other"] = std::string("new");
+			std::ostringstream replaced(std::ios::binary);
+			writer.WriteDelta(scope, replaced);
+			reader.ApplyDelta(*copy, replaced.str());
+			Assert::IsTrue(*copy == scope);
+			Assert::AreEqual(scope.ToString(), copy->ToString());
+			delete copy;
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			mHelper.Setup();
+		}
+
+		TEST_METHOD_CLEANUP(Teardown)
+		{
+			mHelper.Teardown();
+		}
+
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			mHelper.BeginClass();
+		}
+
+		TEST_CLASS_CLEANUP(CleanupClass)
+		{
+			mHelper.EndClass();
+		}
+
+		static TestClassHelper mHelper;
+		static const std::string WorldXmlFile;
+		static const std::string BinaryWorldFile;
+	};
+
+	TestClassHelper BinaryWorldTest::mHelper;
+	const std::string BinaryWorldTest::WorldXmlFile = "TestData/world.xml";
+	const std::string BinaryWorldTest::BinaryWorldFile = "TestData/world.bin";
+}
@@ -0,0 +1,156 @@
+#include "Pch.h"
+#include <atomic>
+#include <string>
+#include "ConcurrentHashMap.h"
+#include "JobSystem.h"
+#include "TestClassHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTestLibraryDesktop
+{
+	using namespace AnonymousEngine;
+	using namespace AnonymousEngine::Core;
+
+	TEST_CLASS(ConcurrentHashMapTest)
+	{
+	public:
+		TEST_METHOD(TestInsertFindRemove)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { ConcurrentHashMap<std::string, std::uint32_t> map(0U); });
+
+			ConcurrentHashMap<std::string, std::uint32_t> map;
+			Assert::AreEqual(0U, map.Size());
+			Assert::IsTrue(map.begin() == map.end());
+
+			std::uint32_t data = 0;
+			Assert::IsTrue(map.Insert(std::make_pair("Hello", 1U)));
+			Assert::IsFalse(map.Insert(std::make_pair("Hello", 2U)));
+			Assert::IsTrue(map.Find(std::string("Hello"), data));
+			Assert::AreEqual(1U, data);
+			Assert::IsTrue(map.Find("Hello", data));
+			Assert::IsFalse(map.Find("World", data));
+			Assert::AreEqual(1U, data);
+			Assert::IsTrue(map.ContainsKey("Hello"));
+			Assert::IsFalse(map.ContainsKey(std::string("World")));
+
+			// the data can be looked at in place, and a missing key isn't inserted
+			const std::uint32_t* found = map.Find("Hello");
+			Assert::IsNotNull(found);
+			Assert::AreEqual(1U, *found);
+			Assert::IsNull(map.Find(std::string("World")));
+			Assert::AreEqual(1U, map.Size());
+
+			map["World"] = 3U;
+			Assert::AreEqual(3U, map["World"]);
+			map.Update("World", [](std::uint32_t& value) { value *= 2; });
+			map.Update("Foo", [](std::uint32_t& value) { Assert::AreEqual(0U, value); value = 7U; });
+			Assert::AreEqual(6U, map["World"]);
+			Assert::AreEqual(7U, map["Foo"]);
+			Assert::AreEqual(3U, map.Size());
+
+			Assert::IsTrue(map.Remove("Foo"));
+			Assert::IsFalse(map.Remove("Foo"));
+			Assert::IsFalse(map.ContainsKey("Foo"));
+			Assert::AreEqual(2U, map.Size());
+
+			map.Clear();
+			Assert::AreEqual(0U, map.Size());
+			Assert::IsFalse(map.ContainsKey("Hello"));
+		}
+
+		TEST_METHOD(TestIteration)
+		{
+			ConcurrentHashMap<std::uint32_t, std::uint32_t> map(3U);
+			const std::uint32_t count = 200U;
+			for (std::uint32_t key = 0; key < count; ++key)
+			{
+				map.Insert(std::make_pair(key, key * 2));
+			}
+
+			// every entry is visited once, across every shard
+			bool visited[count] = {};
+			std::uint32_t iterated = 0;
+			for (auto it = map.begin(); it != map.end(); ++it)
+			{
+				Assert::AreEqual(it->first * 2, (*it).second);
+				Assert::IsFalse(visited[it->first]);
+				visited[it->first] = true;
+				++iterated;
+			}
+			Assert::AreEqual(count, iterated);
+			Assert::ExpectException<std::out_of_range>([&map]() { auto it = map.end(); ++it; });
+			Assert::ExpectException<std::invalid_argument>([]() { ConcurrentHashMap<std::uint32_t, std::uint32_t>::Iterator it; ++it; });
+
+			std::uint32_t sum = 0;
+			map.ForEach([&sum](const std::pair<const std::uint32_t, std::uint32_t>& entry) { sum += entry.second; });
+			Assert::AreEqual(count * (count - 1), sum);
+		}
+
+		TEST_METHOD(TestConcurrentAccess)
+		{
+			JobSystem jobSystem(3);
+			ConcurrentHashMap<std::uint32_t, std::uint32_t> map;
+			const std::uint32_t count = 20000U;
+			for (std::uint32_t key = 0; key < count; key += 2)
+			{
+				map.Insert(std::make_pair(key, key));
+			}
+
+			// the odd keys are inserted and removed while the even ones are looked up from every thread
+			std::atomic<std::uint32_t> found(0);
+			jobSystem.ParallelFor(0, count, [&map, &found](std::uint32_t begin, std::uint32_t end)
+			{
+				for (std::uint32_t key = begin; key < end; ++key)
+				{
+					if (key % 2 == 1)
+					{
+						map.Insert(std::make_pair(key, key));
+						map.Update(key, [key](std::uint32_t& value) { value += key; });
+						if (key % 4 == 3)
+						{
+							map.Remove(key);
+						}
+						continue;
+					}
+					std::uint32_t data;
+					if (map.Find(key, data) && data == key)
+					{
+						++found;
+					}
+				}
+			}, 64U);
+
+			Assert::AreEqual(count / 2, found.load());
+			Assert::AreEqual(count / 2 + count / 4, map.Size());
+			for (std::uint32_t key = 1; key < count; key += 4)
+			{
+				Assert::AreEqual(key * 2, map[key]);
+			}
+		}
+
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			mHelper.BeginClass();
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			mHelper.Setup();
+		}
+
+		TEST_METHOD_CLEANUP(Teardown)
+		{
+			mHelper.Teardown();
+		}
+
+		TEST_CLASS_CLEANUP(CleanupClass)
+		{
+			mHelper.EndClass();
+		}
+	private:
+		static TestClassHelper mHelper;
+	};
+
+	TestClassHelper ConcurrentHashMapTest::mHelper;
+}
@@ -2,13 +2,17 @@
 #include "BarSubscriber.h"
 #include "Event.h"
 #include "EventQueue.h"
+#include "EventStatistics.h"
 #include "FooSubscriber.h"
+#include "GameClock.h"
+#include "Histogram.h"
 #include "TestClassHelper.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 namespace UnitTestLibraryDesktop
 {
+	using namespace AnonymousEngine;
 	using namespace AnonymousEngine::Core;
 	using namespace std::chrono;
 
@@ -45,6 +49,155 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(barData == *barSubscriber.EventData());
 		}
 
+		TEST_METHOD(TestTypedDelivery)
+		{
+			std::uint32_t fooCount = 0;
+			const Foo* fooMessage = nullptr;
+			auto fooCallable = [&fooCount, &fooMessage](const Foo& message)
+			{
+				++fooCount;
+				fooMessage = &message;
+			};
+			std::uint32_t barCount = 0;
+			auto barCallable = [&barCount](const Bar&) { ++barCount; };
+
+			Foo fooData(mHelper.GetRandomUInt32());
+			auto fooEvent = std::make_shared<Event<Foo>>(fooData);
+			FooSubscriber fooSubscriber;
+			Event<Foo>::Subscribe(fooSubscriber);
+			Event<Foo>::Subscribe(fooCallable);
+			Event<Bar>::Subscribe(barCallable);
+
+			EventQueue::Send(fooEvent);
+			Assert::IsTrue(fooSubscriber.IsNotified());
+			Assert::AreEqual(1U, fooCount);
+			Assert::IsTrue(fooData == *fooMessage);
+			Assert::AreEqual(0U, barCount);
+
+			Event<Foo>::Unsubscribe(fooCallable);
+			fooEvent->Deliver();
+			Assert::AreEqual(1U, fooCount);
+
+			Bar barData(mHelper.GetRandomUInt32());
+			Event<Bar> barEvent(barData);
+			barEvent.Deliver();
+			Assert::AreEqual(1U, barCount);
+			Event<Bar>::UnsubscribeAll();
+			barEvent.Deliver();
+			Assert::AreEqual(1U, barCount);
+		}
+
+		TEST_METHOD(TestConstAndFunctionDelivery)
+		{
+			struct ConstCallable
+			{
+				std::uint32_t* mCount;
+				void operator()(const Foo&) const { ++(*mCount); }
+			};
+			std::uint32_t constCount = 0;
+			const ConstCallable constCallable = { &constCount };
+			std::uint32_t lambdaCount = 0;
+			const auto constLambda = [&lambdaCount](const Foo&) { ++lambdaCount; };
+			sFunctionCount = 0;
+
+			Event<Foo>::Subscribe(constCallable);
+			Event<Foo>::Subscribe(constLambda);
+			Event<Foo>::Subscribe(CountFoo);
+			Event<Foo> fooEvent(Foo(mHelper.GetRandomUInt32()));
+			fooEvent.Deliver();
+			Assert::AreEqual(1U, constCount);
+			Assert::AreEqual(1U, lambdaCount);
+			Assert::AreEqual(1U, sFunctionCount);
+
+			// the function is timed like any other callable
+			EventStatistics statistics;
+			EventPublisher::SetStatistics(&statistics);
+			fooEvent.Deliver();
+			EventPublisher::SetStatistics(nullptr);
+			Assert::AreEqual(3U, statistics.Callables().Size());
+			Assert::AreEqual(2U, sFunctionCount);
+
+			Event<Foo>::Unsubscribe(CountFoo);
+			Event<Foo>::Unsubscribe(constCallable);
+			fooEvent.Deliver();
+			Assert::AreEqual(2U, constCount);
+			Assert::AreEqual(3U, lambdaCount);
+			Assert::AreEqual(2U, sFunctionCount);
+
+			Event<Foo>::Unsubscribe(constLambda);
+			fooEvent.Deliver();
+			Assert::AreEqual(3U, lambdaCount);
+		}
+
+		TEST_METHOD(TestSubscriptionChangesDuringDelivery)
+		{
+			class UnsubscribingSubscriber final : public EventSubscriber
+			{
+			public:
+				std::uint32_t mCount = 0;
+				void Notify(EventPublisher&) override
+				{
+					++mCount;
+					Event<Foo>::Unsubscribe(*this);
+				}
+			};
+			struct CountingCallable
+			{
+				std::uint32_t mCount;
+				void operator()(const Foo&) { ++mCount; }
+			};
+			struct SubscribingCallable
+			{
+				CountingCallable* mLate;
+				std::uint32_t mLateCount;
+				std::uint32_t mCount;
+				void operator()(const Foo&)
+				{
+					++mCount;
+					Event<Foo>::Unsubscribe(*this);
+					for (std::uint32_t index = 0; index < mLateCount; ++index)
+					{
+						Event<Foo>::Subscribe(mLate[index]);
+					}
+				}
+			};
+
+			// the subscriber after one which unsubscribes is still notified, and callables subscribed on the way, enough
+			// to move the list, are invoked in the same delivery
+			UnsubscribingSubscriber unsubscribing;
+			FooSubscriber fooSubscriber;
+			Event<Foo>::Subscribe(unsubscribing);
+			Event<Foo>::Subscribe(fooSubscriber);
+			CountingCallable late[16] = {};
+			SubscribingCallable subscribing = { late, 16U, 0U };
+			Event<Foo>::Subscribe(subscribing);
+
+			EventStatistics statistics;
+			EventPublisher::SetStatistics(&statistics);
+			Foo fooData(mHelper.GetRandomUInt32());
+			Event<Foo> fooEvent(fooData);
+			fooEvent.Deliver();
+			Assert::AreEqual(1U, unsubscribing.mCount);
+			Assert::IsTrue(fooSubscriber.IsNotified());
+			Assert::AreEqual(1U, subscribing.mCount);
+			for (const auto& callable : late)
+			{
+				Assert::AreEqual(1U, callable.mCount);
+			}
+
+			fooEvent.Deliver();
+			Assert::AreEqual(1U, unsubscribing.mCount);
+			Assert::AreEqual(1U, subscribing.mCount);
+			Assert::AreEqual(2U, late[15].mCount);
+
+			// callables are timed like subscribers
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(statistics.Subscribers()[&unsubscribing].Count()));
+			Assert::AreEqual(2ULL, static_cast<unsigned long long>(statistics.Subscribers()[&fooSubscriber].Count()));
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(statistics.Callables()[&subscribing].Count()));
+			Assert::AreEqual(2ULL, static_cast<unsigned long long>(statistics.Callables()[&late[0]].Count()));
+			EventPublisher::SetStatistics(nullptr);
+		}
+
 		TEST_METHOD(TestDelayedDelivery)
 		{
 			EventQueue queue;
@@ -62,12 +215,12 @@ namespace UnitTestLibraryDesktop
 			Bar barData(mHelper.GetRandomUInt32());
 			auto barEvent = std::make_shared<Event<Bar>>(barData);
 			Event<Bar>::Subscribe(barSubscriber);
-			time.SetCurrentTime(time.CurrentTime() + milliseconds(1U));
+			time.SetTotalGameTime(time.TotalGameTime() + milliseconds(1U));
 			queue.Enqueue(barEvent, time, barTime);
 
 			Bar barData2(mHelper.GetRandomUInt32());
 			auto barEvent2 = std::make_shared<Event<Bar>>(barData2);
-			time.SetCurrentTime(time.CurrentTime());
+			time.SetTotalGameTime(time.TotalGameTime());
 			queue.Enqueue(barEvent2, time, fooTime + 10);
 
 			Assert::IsFalse(fooSubscriber.IsNotified());
@@ -75,21 +228,21 @@ namespace UnitTestLibraryDesktop
 			Assert::IsFalse(barSubscriber.IsNotified());
 			Assert::IsNull(barSubscriber.EventData());
 
-			time.SetCurrentTime(time.CurrentTime() + milliseconds(barTime - 2));
+			time.SetTotalGameTime(time.TotalGameTime() + milliseconds(barTime - 2));
 			queue.Update(time);
 			Assert::IsFalse(fooSubscriber.IsNotified());
 			Assert::IsNull(fooSubscriber.EventData());
 			Assert::IsFalse(barSubscriber.IsNotified());
 			Assert::IsNull(barSubscriber.EventData());
 
-			time.SetCurrentTime(time.CurrentTime() + milliseconds(2));
+			time.SetTotalGameTime(time.TotalGameTime() + milliseconds(2));
 			queue.Update(time);
 			Assert::IsFalse(fooSubscriber.IsNotified());
 			Assert::IsNull(fooSubscriber.EventData());
 			Assert::IsTrue(barSubscriber.IsNotified());
 			Assert::IsTrue(barData == *barSubscriber.EventData());
 
-			time.SetCurrentTime(time.CurrentTime() + milliseconds(fooTime - barTime + 4));
+			time.SetTotalGameTime(time.TotalGameTime() + milliseconds(fooTime - barTime + 4));
 			queue.Update(time);
 			Assert::IsTrue(fooSubscriber.IsNotified());
 			Assert::IsTrue(fooData == *fooSubscriber.EventData());
@@ -97,7 +250,7 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(barData == *barSubscriber.EventData());
 
 			Assert::IsFalse(barData2 == *barSubscriber.EventData());
-			time.SetCurrentTime(time.CurrentTime() + milliseconds(fooTime + 10));
+			time.SetTotalGameTime(time.TotalGameTime() + milliseconds(fooTime + 10));
 			queue.Update(time);
 			Assert::IsTrue(barData2 == *barSubscriber.EventData());
 		}
@@ -128,6 +281,141 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(0U, queue.Size());
 		}
 
+		TEST_METHOD(TestFixedTimestepDelivery)
+		{
+			EventQueue queue;
+			GameClock clock;
+			GameTime time;
+			const milliseconds step(16);
+
+			FooSubscriber fooSubscriber;
+			Event<Foo>::Subscribe(fooSubscriber);
+			Foo fooData(mHelper.GetRandomUInt32());
+			queue.Enqueue(std::make_shared<Event<Foo>>(fooData), time, 100U);
+
+			// The wall clock doesn't matter, only the number of steps taken
+			std::uint32_t steps = 0;
+			while (!fooSubscriber.IsNotified())
+			{
+				clock.StepGameTime(time, step);
+				queue.Update(time);
+				++steps;
+			}
+			Assert::AreEqual(7U, steps);
+			Assert::IsTrue(time.TotalGameTime() == milliseconds(112));
+			Assert::IsTrue(time.ElapsedGameTime() == step);
+			Assert::IsTrue(time.CurrentTime() == clock.StartTime() + milliseconds(112));
+			Assert::IsTrue(queue.IsEmpty());
+
+			clock.Reset();
+			Assert::IsFalse(clock.FixedStep(time, step));
+			Assert::IsTrue(time.TotalGameTime() == milliseconds(112));
+		}
+
+		TEST_METHOD(TestFixedStepCarriesRemainder)
+		{
+			GameClock clock;
+			GameTime time;
+			const milliseconds step(16);
+
+			// 50ms of frame time is three whole steps, the 2ms left over waits for the next frame
+			clock.Accumulate(milliseconds(50));
+			std::uint32_t steps = 0;
+			while (clock.FixedStep(time, step))
+			{
+				++steps;
+			}
+			Assert::AreEqual(3U, steps);
+			Assert::IsTrue(time.TotalGameTime() == milliseconds(48));
+			Assert::IsTrue(time.ElapsedGameTime() == step);
+			Assert::IsTrue(clock.AccumulatedTime() == milliseconds(2));
+
+			// a frame shorter than a step still gets one once the remainder tops it up
+			clock.Accumulate(milliseconds(14));
+			Assert::IsTrue(clock.FixedStep(time, step));
+			Assert::IsFalse(clock.FixedStep(time, step));
+			Assert::IsTrue(time.TotalGameTime() == milliseconds(64));
+			Assert::IsTrue(clock.AccumulatedTime() == milliseconds(0));
+
+			clock.Accumulate(milliseconds(15));
+			Assert::IsFalse(clock.FixedStep(time, step));
+			Assert::IsTrue(time.TotalGameTime() == milliseconds(64));
+			Assert::IsTrue(clock.AccumulatedTime() == milliseconds(15));
+		}
+
+		TEST_METHOD(TestEventStatistics)
+		{
+			EventStatistics statistics;
+			EventQueue queue;
+			queue.SetStatistics(&statistics);
+			EventPublisher::SetStatistics(&statistics);
+			GameTime time;
+
+			FooSubscriber fooSubscriber;
+			Event<Foo>::Subscribe(fooSubscriber);
+			Foo fooData(mHelper.GetRandomUInt32());
+			Bar barData(mHelper.GetRandomUInt32());
+			queue.Enqueue(std::make_shared<Event<Foo>>(fooData), time, 10U);
+			queue.Enqueue(std::make_shared<Event<Foo>>(fooData), time, 20U);
+			queue.Enqueue(std::make_shared<Event<Bar>>(barData), time, 10U);
+
+			const auto& fooStatistics = statistics.EventTypes()[Event<Foo>::TypeIdClass()];
+			const auto& barStatistics = statistics.EventTypes()[Event<Bar>::TypeIdClass()];
+			Assert::AreEqual(2ULL, static_cast<unsigned long long>(fooStatistics.mEnqueueCount));
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(barStatistics.mEnqueueCount));
+			Assert::AreEqual(3ULL, static_cast<unsigned long long>(statistics.QueueDepth().Max()));
+
+			time.SetTotalGameTime(time.TotalGameTime() + milliseconds(25U));
+			queue.Update(time);
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::AreEqual(2ULL, static_cast<unsigned long long>(fooStatistics.mDeliveryCount));
+			Assert::AreEqual(2ULL, static_cast<unsigned long long>(fooStatistics.mDeliveryLatency.Count()));
+			Assert::AreEqual(5000ULL, static_cast<unsigned long long>(fooStatistics.mDeliveryLatency.Min()));
+			Assert::AreEqual(15000ULL, static_cast<unsigned long long>(fooStatistics.mDeliveryLatency.Max()));
+			Assert::AreEqual(10000.0, fooStatistics.mDeliveryLatency.Mean(), 0.001);
+			Assert::AreEqual(2ULL, static_cast<unsigned long long>(statistics.Subscribers()[&fooSubscriber].Count()));
+
+			EventStatistics snapshot = statistics.Snapshot();
+			statistics.Reset();
+			Assert::AreEqual(0U, statistics.EventTypes().Size());
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(statistics.QueueDepth().Count()));
+			Assert::AreEqual(2U, snapshot.EventTypes().Size());
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(snapshot.EventTypes()[Event<Bar>::TypeIdClass()].mDeliveryCount));
+
+			EventPublisher::SetStatistics(nullptr);
+		}
+
+		TEST_METHOD(TestHistogram)
+		{
+			Histogram histogram;
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(histogram.ValueAtPercentile(50.0)));
+			for (std::uint64_t value = 1; value <= 1000; ++value)
+			{
+				histogram.Record(value);
+			}
+			Assert::AreEqual(1000ULL, static_cast<unsigned long long>(histogram.Count()));
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(histogram.Min()));
+			Assert::AreEqual(1000ULL, static_cast<unsigned long long>(histogram.Max()));
+			Assert::AreEqual(500.5, histogram.Mean(), 0.001);
+			Assert::AreEqual(1000ULL, static_cast<unsigned long long>(histogram.ValueAtPercentile(100.0)));
+
+			std::uint64_t median = histogram.ValueAtPercentile(50.0);
+			Assert::IsTrue(median >= 500 && median <= 500 + 500 / 8);
+			std::uint64_t p99 = histogram.ValueAtPercentile(99.0);
+			Assert::IsTrue(p99 >= 990 && p99 <= 1000);
+
+			Histogram other;
+			other.Record(UINT64_MAX);
+			histogram.Merge(other);
+			Assert::AreEqual(1001ULL, static_cast<unsigned long long>(histogram.Count()));
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(histogram.CountAtValue(UINT64_MAX)));
+			Assert::AreEqual(static_cast<unsigned long long>(UINT64_MAX), static_cast<unsigned long long>(histogram.Max()));
+
+			histogram.Reset();
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(histogram.Count()));
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(histogram.Max()));
+		}
+
 		TEST_CLASS_INITIALIZE(InitializeClass)
 		{
 			mHelper.BeginClass();
@@ -154,8 +442,16 @@ namespace UnitTestLibraryDesktop
 			mHelper.EndClass();
 		}
 
+		// A free function subscribed to events, counting how often it is called
+		static void CountFoo(const Foo&)
+		{
+			++sFunctionCount;
+		}
+
+		static std::uint32_t sFunctionCount;
 		static TestClassHelper mHelper;
 	};
 
+	std::uint32_t EventTest::sFunctionCount = 0;
 	TestClassHelper EventTest::mHelper;
 }
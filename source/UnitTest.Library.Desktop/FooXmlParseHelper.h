@@ -8,7 +8,7 @@ namespace UnitTestLibraryDesktop
 {
 	typedef AnonymousEngine::Parsers::IXmlParserHelper IXmlParserHelper;
 	typedef AnonymousEngine::Parsers::SharedData SharedData;
-	typedef AnonymousEngine::HashMap<std::string, std::string> AttributeMap;
+	typedef AnonymousEngine::Parsers::XmlAttributes AttributeMap;
 	typedef const AnonymousEngine::HashMap<std::string, std::function<void(class FooXmlParserHelper&, const AttributeMap&)>> TagHandlerMap;
 
 	class FooXmlParserHelper final : public IXmlParserHelper
@@ -16,9 +16,10 @@ namespace UnitTestLibraryDesktop
 	public:
 		FooXmlParserHelper() = default;
 		void Initialize() override;
+		bool IsSharedDataSupported(const SharedData& sharedData) const override;
 		bool StartElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes) override;
 		bool EndElementHandler(SharedData& sharedData, const std::string& name) override;
-		void CharDataHandler(SharedData& sharedData, const std::string& buffer) override;
+		void CharDataHandler(SharedData& sharedData, const XML_Char* buffer, std::uint32_t length) override;
 		IXmlParserHelper* Create() override;
 		~FooXmlParserHelper() = default;
 
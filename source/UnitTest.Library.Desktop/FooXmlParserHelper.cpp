@@ -1,5 +1,7 @@
 #include "Pch.h"
 #include "FooXmlParseHelper.h"
+#include <algorithm>
+#include <cctype>
 #include "XmlParseMaster.h"
 #include "FooSharedData.h"
 
@@ -20,18 +22,29 @@ namespace UnitTestLibraryDesktop
 		mStack.Clear();
 	}
 
-	bool FooXmlParserHelper::StartElementHandler(SharedData& sharedData, const std::string& name, const AttributeMap& attributes)
+	bool FooXmlParserHelper::IsSharedDataSupported(const SharedData& sharedData) const
+	{
+		return sharedData.Is<FooSharedData>();
+	}
+
+	bool FooXmlParserHelper::StartElementHandler(SharedData&, const std::string& name, const AttributeMap& attributes)
 	{
-		if (!sharedData.Is(FooSharedData::TypeIdClass()))
-		{
-			return false;
-		}
 		mStack.PushBack(name);
 		if (SupportedTags.Find(name) != SupportedTags.end())
 		{
 			AnonymousEngine::Scope* scope = new AnonymousEngine::Scope();
 			mStack.Back().mScope = scope;
+			// add the attributes by their lower case names, sorted so the scope doesn't depend on the document order
+			AnonymousEngine::Vector<std::pair<std::string, std::string>> sortedAttributes(attributes.Size());
 			for (const auto& attribute : attributes)
+			{
+				std::string attributeName(attribute.first);
+				std::transform(attributeName.begin(), attributeName.end(), attributeName.begin(), ::tolower);
+				sortedAttributes.PushBack(std::make_pair(attributeName, std::string(attribute.second)));
+			}
+			auto items = sortedAttributes.Items();
+			std::sort(items.begin(), items.end());
+			for (const auto& attribute : sortedAttributes)
 			{
 				scope->Append(attribute.first) = attribute.second;
 			}
@@ -42,10 +55,6 @@ namespace UnitTestLibraryDesktop
 
 	bool FooXmlParserHelper::EndElementHandler(SharedData& sharedData, const std::string& name)
 	{
-		if (!sharedData.Is(FooSharedData::TypeIdClass()))
-		{
-			return false;
-		}
 		if (SupportedTags.Find(name) != SupportedTags.end())
 		{
 			ParsingStackDataElement element = mStack.Back();
@@ -64,13 +73,13 @@ namespace UnitTestLibraryDesktop
 		return false;
 	}
 
-	void FooXmlParserHelper::CharDataHandler(SharedData&, const std::string& buffer)
+	void FooXmlParserHelper::CharDataHandler(SharedData&, const XML_Char* buffer, std::uint32_t length)
 	{
 		if (SupportedTags.Find(mStack.Back().mElementName) == SupportedTags.end())
 		{
 			ParsingStackDataElement charDataElement = mStack.Back();
 			mStack.PopBack();
-			mStack.Back().mScope->Append(charDataElement.mElementName) = buffer;
+			mStack.Back().mScope->Append(charDataElement.mElementName) = std::string(buffer, length);
 		}
 	}
 
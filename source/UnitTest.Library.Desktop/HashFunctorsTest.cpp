@@ -1,9 +1,11 @@
 #include "Pch.h"
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include "Foo.h"
 #include "TestClassHelper.h"
 #include "HashFunctors.h"
+#include "HashedName.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -87,6 +89,85 @@ namespace UnitTestLibraryDesktop
 			Assert::AreNotEqual(fooFunctor(f1), fooFunctor(f3));
 		}
 
+		TEST_METHOD(TestFastHash)
+		{
+			std::int8_t data[300];
+			for (auto& byte : data)
+			{
+				byte = static_cast<std::int8_t>(mHelper.GetRandomUInt32());
+			}
+			Assert::AreEqual(0U, AnonymousEngine::HashFunctions::FastHash(data, 0));
+
+			// every bit of keys of every path affects the hash, and the hash doesn't depend on where the key is
+			const std::uint32_t lengths[] = { 1, 3, 4, 9, 16, 17, 32, 33, 64, 65, 257, 299 };
+			for (std::uint32_t length : lengths)
+			{
+				std::uint32_t hash = AnonymousEngine::HashFunctions::FastHash(data, length);
+				std::int8_t copy[300];
+				std::memcpy(copy + 1, data, length);
+				Assert::AreEqual(hash, AnonymousEngine::HashFunctions::FastHash(copy + 1, length));
+				Assert::AreNotEqual(hash, AnonymousEngine::HashFunctions::FastHash(data, length - 1));
+				for (std::uint32_t bit = 0; bit < length * 8; ++bit)
+				{
+					copy[1 + bit / 8] ^= static_cast<std::int8_t>(1 << (bit % 8));
+					Assert::AreNotEqual(hash, AnonymousEngine::HashFunctions::FastHash(copy + 1, length));
+					copy[1 + bit / 8] ^= static_cast<std::int8_t>(1 << (bit % 8));
+				}
+			}
+
+			// strings and C strings hash the same
+			const char* text = "A key long enough to take the striped path of the hash";
+			AnonymousEngine::DefaultHashFunctor<const std::string> stringFunctor;
+			Assert::AreEqual(stringFunctor(std::string(text)), stringFunctor(text));
+			Assert::AreEqual(stringFunctor(text), AnonymousEngine::DefaultHashFunctor<const char*>()(text));
+		}
+
+		TEST_METHOD(TestConstantHash)
+		{
+			// hashed by the compiler
+			static constexpr AnonymousEngine::HashedName name("Entities");
+			static_assert(name.Hash() != 0U && name.Length() == 8U, "Names are hashed at compile time");
+			AnonymousEngine::DefaultHashFunctor<const std::string> stringFunctor;
+			Assert::AreEqual(stringFunctor(std::string("Entities")), name.Hash());
+			Assert::AreEqual(stringFunctor(std::string("Entities")), stringFunctor(name));
+			Assert::AreEqual(stringFunctor(std::string("This one is long enough to go through several stripes, scrambles included, "
+				"which only happen past two hundred and fifty six bytes. So here is some more text to get there, and a bit more.")),
+				AnonymousEngine::HashedName("This one is long enough to go through several stripes, scrambles included, "
+				"which only happen past two hundred and fifty six bytes. So here is some more text to get there, and a bit more.").Hash());
+
+			// every length takes the same path as at runtime
+			std::string text;
+			for (std::uint32_t length = 0; length < 600; ++length)
+			{
+				Assert::AreEqual(AnonymousEngine::HashFunctions::FastHash(reinterpret_cast<const std::int8_t*>(text.c_str()), length),
+					AnonymousEngine::HashFunctions::ConstantHash(text.c_str(), length));
+				text.push_back(static_cast<char>(mHelper.GetRandomUInt32()));
+			}
+
+			std::string runtime = "Sectors";
+			Assert::AreEqual(AnonymousEngine::HashedName("Sectors").Hash(), AnonymousEngine::HashedName(runtime).Hash());
+			Assert::AreEqual(runtime, AnonymousEngine::HashedName(runtime).ToString());
+		}
+
+		TEST_METHOD(TestHashFunctionWithIntegers)
+		{
+			enum class Color { Red, Green };
+			std::uint32_t value = mHelper.GetRandomUInt32();
+			Assert::AreEqual(AnonymousEngine::HashFunctions::MixInteger(value), AnonymousEngine::DefaultHashFunctor<const std::uint32_t>()(value));
+			Assert::AreEqual(AnonymousEngine::HashFunctions::MixInteger(1U), AnonymousEngine::DefaultHashFunctor<Color>()(Color::Green));
+			Assert::AreEqual(AnonymousEngine::HashFunctions::MixInteger(reinterpret_cast<std::uintptr_t>(&value)), AnonymousEngine::DefaultHashFunctor<std::uint32_t*>()(&value));
+
+			// neighbouring aligned pointers spread over the buckets
+			std::uint64_t values[64];
+			bool buckets[16] = {};
+			AnonymousEngine::DefaultHashFunctor<std::uint64_t*> pointerFunctor;
+			for (auto& element : values)
+			{
+				buckets[pointerFunctor(&element) % 16U] = true;
+			}
+			Assert::IsTrue(std::count(std::begin(buckets), std::end(buckets), true) >= 12);
+		}
+
 		TEST_CLASS_INITIALIZE(InitializeClass)
 		{
 			mHelper.BeginClass();
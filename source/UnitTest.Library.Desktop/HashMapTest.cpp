@@ -1,4 +1,6 @@
 #include "Pch.h"
+#include <algorithm>
+#include <cctype>
 #include "HashMapTestTemplate.h"
 #include "TestClassHelper.h"
 #include "ToStringTemplates.h"
@@ -19,6 +21,34 @@ namespace AnonymousEngine
 	};
 }
 
+namespace UnitTestLibraryDesktop
+{
+	// Hashes strings by their length, so strings of different lengths never need a key compare
+	class LengthHashFunctor
+	{
+	public:
+		std::uint32_t operator()(const std::string& data) const
+		{
+			return static_cast<std::uint32_t>(data.size());
+		}
+	};
+
+	// Compares strings ignoring case and counts the compares
+	class CaseInsensitiveCompare
+	{
+	public:
+		bool operator()(const std::string& lhs, const std::string& rhs) const
+		{
+			++sCompareCount;
+			return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char left, char right) { return std::tolower(left) == std::tolower(right); });
+		}
+
+		static std::uint32_t sCompareCount;
+	};
+
+	std::uint32_t CaseInsensitiveCompare::sCompareCount = 0;
+}
+
 namespace UnitTestLibraryDesktop
 {
 	TEST_CLASS(HashMapTest)
@@ -252,6 +282,62 @@ namespace UnitTestLibraryDesktop
 			HashMapTestTemplate<Foo>::TestClear(Foo(value1), Foo(value2));
 		}
 
+		TEST_METHOD(TestCompareFunctor)
+		{
+			AnonymousEngine::HashMap<std::string, std::uint32_t, LengthHashFunctor, CaseInsensitiveCompare> map(1U);
+			map["Hello"] = 1U;
+			map["World!"] = 2U;
+			map["Hi"] = 3U;
+
+			// the compare functor is used, and only for keys with the same hash
+			CaseInsensitiveCompare::sCompareCount = 0;
+			Assert::IsTrue(map.ContainsKey("HELLO"));
+			Assert::AreEqual(1U, CaseInsensitiveCompare::sCompareCount);
+			Assert::AreEqual(2U, map["world!"]);
+			Assert::IsFalse(map.ContainsKey("Hello?"));
+			Assert::AreEqual(3U, map.Size());
+			Assert::IsTrue(map.Remove("hI"));
+			Assert::AreEqual(2U, map.Size());
+
+			// copies keep the order of every chain
+			AnonymousEngine::HashMap<std::string, std::uint32_t, LengthHashFunctor, CaseInsensitiveCompare> copy(map);
+			Assert::IsTrue(copy.begin()->first == map.begin()->first);
+			Assert::IsTrue(copy == map);
+		}
+
+		TEST_METHOD(TestHeterogeneousLookup)
+		{
+			AnonymousEngine::HashMap<std::string, std::uint32_t> map;
+			map.Insert(std::make_pair(std::string("hello1"), 1U));
+			map.Insert(std::make_pair(std::string("hello2"), 2U));
+
+			const char* key = "hello2";
+			Assert::IsTrue(map.Find(key) == map.Find(std::string(key)));
+			Assert::AreEqual(2U, map.Find(key)->second);
+			Assert::IsTrue(map.ContainsKey("hello1"));
+			Assert::IsFalse(map.ContainsKey("hello3"));
+			Assert::IsTrue(map.Find("hello") == map.end());
+
+			const AnonymousEngine::HashMap<std::string, std::uint32_t>& constMap = map;
+			Assert::AreEqual(1U, (*constMap.Find("hello1")).second);
+		}
+
+		TEST_METHOD(TestRemoveFromStaticMap)
+		{
+			// the map outlives the test, so in debug the teardown checkpoint fails if removing its entries keeps their slabs
+			for (std::uint32_t index = 0; index < 100U; ++index)
+			{
+				sStaticMap[index] = index;
+			}
+			Assert::AreEqual(100U, sStaticMap.Size());
+			for (std::uint32_t index = 0; index < 100U; ++index)
+			{
+				Assert::IsTrue(sStaticMap.Remove(index));
+			}
+			Assert::AreEqual(0U, sStaticMap.Size());
+			Assert::IsTrue(sStaticMap.begin() == sStaticMap.end());
+		}
+
 		TEST_CLASS_INITIALIZE(InitializeClass)
 		{
 			mHelper.BeginClass();
@@ -273,7 +359,9 @@ namespace UnitTestLibraryDesktop
 		}
 	private:
 		static TestClassHelper mHelper;
+		static AnonymousEngine::HashMap<std::uint32_t, std::uint32_t> sStaticMap;
 	};
 
 	TestClassHelper HashMapTest::mHelper;
+	AnonymousEngine::HashMap<std::uint32_t, std::uint32_t> HashMapTest::sStaticMap;
 }
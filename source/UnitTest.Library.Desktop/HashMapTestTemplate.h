@@ -74,6 +74,11 @@ namespace UnitTestLibraryDesktop
 
 			Assert::AreEqual(size, map2.Size());
 			Assert::IsTrue(value == *map2.begin());
+
+			// the pool came along with the entries, so the chains keep working after the old map is gone
+			Assert::IsTrue(map2.Remove(value2));
+			map2.Insert(pair2);
+			Assert::IsTrue(map2.ContainsKey(value2));
 		}
 
 		static void TestMoveAssignmentOperator(const TKey& value1, const TKey& value2)
@@ -94,6 +99,9 @@ namespace UnitTestLibraryDesktop
 
 			Assert::AreEqual(size, map2.Size());
 			Assert::IsTrue(value == *map2.begin());
+			Assert::IsTrue(map2.Remove(value2));
+			map2.Insert(pair2);
+			Assert::IsTrue(map2.ContainsKey(value2));
 		}
 
 		static void TestFind(const TKey& value1, const TKey& value2, const TKey& value3)
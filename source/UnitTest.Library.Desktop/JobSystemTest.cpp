@@ -0,0 +1,209 @@
+#include "Pch.h"
+#include <atomic>
+#include "JobSystem.h"
+#include "TestClassHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTestLibraryDesktop
+{
+	using namespace AnonymousEngine;
+	using namespace AnonymousEngine::Core;
+
+	TEST_CLASS(JobSystemTest)
+	{
+	public:
+		TEST_METHOD(TestRunAndWait)
+		{
+			for (std::uint32_t workerCount = 0; workerCount < 4; ++workerCount)
+			{
+				JobSystem jobSystem(workerCount);
+				Assert::AreEqual(workerCount, jobSystem.WorkerCount());
+				Assert::IsTrue(jobSystem.IsMainThread());
+
+				JobCounter counter;
+				Assert::IsTrue(counter.IsDone());
+				std::atomic<std::uint32_t> sum(0);
+				std::uint32_t jobCount = (mHelper.GetRandomUInt32() % 100) + 50;
+				for (std::uint32_t index = 1; index <= jobCount; ++index)
+				{
+					jobSystem.Run([&sum, index]() { sum += index; }, &counter);
+				}
+				jobSystem.Wait(counter);
+				Assert::IsTrue(counter.IsDone());
+				Assert::AreEqual(0U, counter.Value());
+				Assert::AreEqual(jobCount * (jobCount + 1) / 2, sum.load());
+			}
+		}
+
+		TEST_METHOD(TestNestedJobs)
+		{
+			JobSystem jobSystem(3);
+			JobCounter counter;
+			std::atomic<std::uint32_t> count(0);
+			for (std::uint32_t index = 0; index < 10; ++index)
+			{
+				jobSystem.Run([&jobSystem, &count]()
+				{
+					JobCounter innerCounter;
+					for (std::uint32_t innerIndex = 0; innerIndex < 10; ++innerIndex)
+					{
+						jobSystem.Run([&count]() { ++count; }, &innerCounter);
+					}
+					jobSystem.Wait(innerCounter);
+				}, &counter);
+			}
+			jobSystem.Wait(counter);
+			Assert::AreEqual(100U, count.load());
+		}
+
+		TEST_METHOD(TestDependencies)
+		{
+			JobSystem jobSystem(2);
+			JobCounter first;
+			JobCounter second;
+			JobCounter third;
+			std::atomic<std::uint32_t> firstDone(0);
+			std::atomic<bool> secondStartedEarly(false);
+			std::atomic<bool> thirdStartedEarly(false);
+
+			for (std::uint32_t index = 0; index < 20; ++index)
+			{
+				jobSystem.Run([&firstDone]() { std::this_thread::yield(); ++firstDone; }, &first);
+			}
+			for (std::uint32_t index = 0; index < 5; ++index)
+			{
+				jobSystem.RunAfter(first, [&firstDone, &secondStartedEarly]()
+				{
+					if (firstDone.load() != 20U)
+					{
+						secondStartedEarly = true;
+					}
+				}, &second);
+			}
+			jobSystem.RunAfter(second, [&second, &thirdStartedEarly]()
+			{
+				if (!second.IsDone())
+				{
+					thirdStartedEarly = true;
+				}
+			}, &third);
+
+			jobSystem.Wait(third);
+			Assert::IsTrue(first.IsDone());
+			Assert::IsTrue(second.IsDone());
+			Assert::IsFalse(secondStartedEarly.load());
+			Assert::IsFalse(thirdStartedEarly.load());
+
+			// a dependency which is already done runs the job right away
+			bool ran = false;
+			jobSystem.RunAfter(first, [&ran]() { ran = true; }, &third);
+			jobSystem.Wait(third);
+			Assert::IsTrue(ran);
+		}
+
+		TEST_METHOD(TestParallelFor)
+		{
+			JobSystem jobSystem(3);
+			const std::uint32_t size = 10000;
+			std::atomic<std::uint32_t>* visits = new std::atomic<std::uint32_t>[size];
+			for (std::uint32_t index = 0; index < size; ++index)
+			{
+				visits[index] = 0;
+			}
+
+			std::uint32_t grainSizes[] = { 0U, 1U, 7U, size, size * 2 };
+			for (std::uint32_t grainSize : grainSizes)
+			{
+				jobSystem.ParallelFor(0, size, [visits](std::uint32_t begin, std::uint32_t end)
+				{
+					for (std::uint32_t index = begin; index < end; ++index)
+					{
+						++visits[index];
+					}
+				}, grainSize);
+			}
+
+			for (std::uint32_t index = 0; index < size; ++index)
+			{
+				Assert::AreEqual(5U, visits[index].load());
+			}
+			delete[] visits;
+
+			bool called = false;
+			jobSystem.ParallelFor(10, 10, [&called](std::uint32_t, std::uint32_t) { called = true; });
+			Assert::IsFalse(called);
+		}
+
+		TEST_METHOD(TestMainThreadJobs)
+		{
+			JobSystem jobSystem(2);
+			JobCounter counter;
+			std::atomic<std::uint32_t> mainThreadRuns(0);
+			std::atomic<std::uint32_t> otherThreadRuns(0);
+
+			auto job = [&jobSystem, &mainThreadRuns, &otherThreadRuns]()
+			{
+				jobSystem.IsMainThread() ? ++mainThreadRuns : ++otherThreadRuns;
+			};
+
+			// workers schedule jobs that have to come back to the main thread
+			for (std::uint32_t index = 0; index < 10; ++index)
+			{
+				jobSystem.Run([&jobSystem, &counter, job]() { jobSystem.RunOnMainThread(job, &counter); }, &counter);
+			}
+			jobSystem.Wait(counter);
+			Assert::AreEqual(10U, mainThreadRuns.load());
+			Assert::AreEqual(0U, otherThreadRuns.load());
+
+			jobSystem.RunOnMainThread(job);
+			jobSystem.RunOnMainThread(job);
+			Assert::AreEqual(2U, jobSystem.ProcessMainThreadJobs());
+			Assert::AreEqual(0U, jobSystem.ProcessMainThreadJobs());
+			Assert::AreEqual(12U, mainThreadRuns.load());
+
+			// processing main thread jobs from a worker is an error, the main thread may pick the job up itself though
+			JobCounter workerCounter;
+			bool threw = false;
+			bool ranOnMainThread = false;
+			jobSystem.Run([&jobSystem, &threw, &ranOnMainThread]()
+			{
+				ranOnMainThread = jobSystem.IsMainThread();
+				try
+				{
+					jobSystem.ProcessMainThreadJobs();
+				}
+				catch (const std::runtime_error&)
+				{
+					threw = true;
+				}
+			}, &workerCounter);
+			jobSystem.Wait(workerCounter);
+			Assert::AreNotEqual(ranOnMainThread, threw);
+		}
+
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			mHelper.BeginClass();
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			mHelper.Setup();
+		}
+
+		TEST_METHOD_CLEANUP(Teardown)
+		{
+			mHelper.Teardown();
+		}
+
+		TEST_CLASS_CLEANUP(CleanupClass)
+		{
+			mHelper.EndClass();
+		}
+
+		static TestClassHelper mHelper;
+	};
+
+	TestClassHelper JobSystemTest::mHelper;
+}
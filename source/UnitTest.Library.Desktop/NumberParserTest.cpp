@@ -0,0 +1,224 @@
+#include "Pch.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include "Datum.h"
+#include "NumberParser.h"
+#include "TestClassHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTestLibraryDesktop
+{
+	using namespace AnonymousEngine;
+
+	TEST_CLASS(NumberParserTest)
+	{
+	public:
+		TEST_METHOD(TestIntegers)
+		{
+			Assert::AreEqual(0, NumberParser::ToInt("0"));
+			Assert::AreEqual(42, NumberParser::ToInt("42"));
+			Assert::AreEqual(-42, NumberParser::ToInt("-42"));
+			Assert::AreEqual(42, NumberParser::ToInt("+42"));
+			Assert::AreEqual(17, NumberParser::ToInt(" \t\n17 apples"));
+			Assert::AreEqual(std::numeric_limits<std::int32_t>::max(), NumberParser::ToInt("2147483647"));
+			Assert::AreEqual(std::numeric_limits<std::int32_t>::min(), NumberParser::ToInt("-2147483648"));
+			Assert::AreEqual(7, NumberParser::ToInt("0000000000000000000000007"));
+
+			std::int32_t value = mHelper.GetRandomInt32();
+			Assert::AreEqual(value, NumberParser::ToInt(std::to_string(value)));
+
+			const std::string text = "123,456";
+			Assert::IsTrue(NumberParser::Parse(text.c_str(), text.c_str() + text.size(), value) == text.c_str() + 3);
+			Assert::AreEqual(123, value);
+
+			Assert::ExpectException<std::invalid_argument>([] { NumberParser::ToInt(""); });
+			Assert::ExpectException<std::invalid_argument>([] { NumberParser::ToInt("-"); });
+			Assert::ExpectException<std::invalid_argument>([] { NumberParser::ToInt("abc"); });
+			Assert::ExpectException<std::out_of_range>([] { NumberParser::ToInt("2147483648"); });
+			Assert::ExpectException<std::out_of_range>([] { NumberParser::ToInt("-2147483649"); });
+			Assert::ExpectException<std::out_of_range>([] { NumberParser::ToInt("99999999999999999999999999"); });
+		}
+
+		TEST_METHOD(TestFloats)
+		{
+			Assert::AreEqual(0.0f, NumberParser::ToFloat("0"));
+			Assert::AreEqual(1.5f, NumberParser::ToFloat("1.5"));
+			Assert::AreEqual(-0.25f, NumberParser::ToFloat("  -.25"));
+			Assert::AreEqual(3.0f, NumberParser::ToFloat("3."));
+			Assert::AreEqual(1500.0f, NumberParser::ToFloat("1.5e3"));
+			Assert::AreEqual(1500.0f, NumberParser::ToFloat("1.5E+3"));
+			Assert::AreEqual(0.0015f, NumberParser::ToFloat("1.5e-3"));
+			Assert::AreEqual(2.0f, NumberParser::ToFloat("2e"));
+			Assert::AreEqual(2.0f, NumberParser::ToFloat("2,5"));
+			Assert::IsTrue(std::signbit(NumberParser::ToFloat("-0.0")));
+			Assert::AreEqual(std::numeric_limits<float>::infinity(), NumberParser::ToFloat("inf"));
+			Assert::AreEqual(-std::numeric_limits<float>::infinity(), NumberParser::ToFloat("-Infinity"));
+			Assert::IsTrue(std::isnan(NumberParser::ToFloat("nan")));
+
+			Assert::ExpectException<std::invalid_argument>([] { NumberParser::ToFloat(""); });
+			Assert::ExpectException<std::invalid_argument>([] { NumberParser::ToFloat("."); });
+			Assert::ExpectException<std::invalid_argument>([] { NumberParser::ToFloat("-e5"); });
+			Assert::ExpectException<std::invalid_argument>([] { NumberParser::ToFloat("x1"); });
+			Assert::ExpectException<std::out_of_range>([] { NumberParser::ToFloat("1e39"); });
+		}
+
+		TEST_METHOD(TestLargestFloats)
+		{
+			// numbers above the largest float still round down to it until halfway to the next power of two
+			const float Largest = std::numeric_limits<float>::max();
+			Assert::AreEqual(Largest, NumberParser::ToFloat("3.4028235e38"));
+			Assert::AreEqual(Largest, NumberParser::ToFloat("3.40282356e38"));
+			Assert::AreEqual(-Largest, NumberParser::ToFloat("-3.40282356e38"));
+			for (const std::string& text : { "3.4028235e38", "3.40282356e38", "-3.40282356e38" })
+			{
+				Assert::AreEqual(std::stof(text), NumberParser::ToFloat(text));
+			}
+
+			// halfway and beyond overflow, as they do for std::stof
+			Assert::ExpectException<std::out_of_range>([] { NumberParser::ToFloat("340282356779733661637539395458142568448"); });
+			Assert::ExpectException<std::out_of_range>([] { NumberParser::ToFloat("3.4028236e38"); });
+			Assert::ExpectException<std::out_of_range>([] { std::stof("3.4028236e38"); });
+			Assert::ExpectException<std::out_of_range>([] { NumberParser::ToFloat("-3.41e38"); });
+		}
+
+		TEST_METHOD(TestFloatsMatchStandardLibrary)
+		{
+			// the fast path, the midpoint fallback and the long mantissa fallback all round like strtof
+			const char* texts[] = { "0.1", "3.4028235e38", "1.17549435e-38", "16777217", "16777219", "0.30000001192092896",
+				"123456789012345678901234567890", "1.000000059604644775390625", "7.038531e-26", "1e-45", "9007199254740993",
+				"0.000000000000000000000000000000000000001", "33554435", "8.589973e9" };
+			for (const char* text : texts)
+			{
+				AssertSameFloat(std::strtof(text, nullptr), NumberParser::ToFloat(text));
+			}
+
+			std::mt19937 generator(mHelper.GetRandomUInt32());
+			std::uniform_int_distribution<std::uint32_t> bits;
+			std::uniform_int_distribution<std::int32_t> digits(1, 20);
+			std::uniform_int_distribution<std::int32_t> exponents(-40, 38);
+			for (std::uint32_t index = 0; index < 10000; ++index)
+			{
+				// values written by the datum serializers
+				std::uint32_t floatBits = bits(generator);
+				float value;
+				std::memcpy(&value, &floatBits, sizeof(value));
+				if (std::isfinite(value))
+				{
+					std::string text = std::to_string(value);
+					AssertSameFloat(std::strtof(text.c_str(), nullptr), NumberParser::ToFloat(text));
+				}
+
+				// arbitrary digit strings with exponents
+				std::string text;
+				std::int32_t digitCount = digits(generator);
+				for (std::int32_t digit = 0; digit < digitCount; ++digit)
+				{
+					text.push_back(static_cast<char>('0' + bits(generator) % 10));
+					if (digit == 0 && digitCount > 1 && bits(generator) % 2 == 0)
+					{
+						text.push_back('.');
+					}
+				}
+				text.append("e").append(std::to_string(exponents(generator)));
+				float expected = std::strtof(text.c_str(), nullptr);
+				if (std::isfinite(expected))
+				{
+					AssertSameFloat(expected, NumberParser::ToFloat(text));
+				}
+			}
+		}
+
+		TEST_METHOD(TestFloatLists)
+		{
+			float values[4];
+			NumberParser::Parse("1.5,-2, 3e2,4", values, 4);
+			Assert::AreEqual(1.5f, values[0]);
+			Assert::AreEqual(-2.0f, values[1]);
+			Assert::AreEqual(300.0f, values[2]);
+			Assert::AreEqual(4.0f, values[3]);
+			Assert::ExpectException<std::invalid_argument>([&values] { NumberParser::Parse("1,2,3", values, 4); });
+			Assert::ExpectException<std::invalid_argument>([&values] { NumberParser::Parse("1,2,,4", values, 4); });
+		}
+
+		TEST_METHOD(TestDatumRoundTrip)
+		{
+			Datum integers;
+			integers.SetType(Datum::DatumType::Integer);
+			Datum floats;
+			floats.SetType(Datum::DatumType::Float);
+			Datum vectors;
+			vectors.SetType(Datum::DatumType::Vector);
+			Datum matrices;
+			matrices.SetType(Datum::DatumType::Matrix);
+			integers.Resize(1);
+			floats.Resize(1);
+			vectors.Resize(1);
+			matrices.Resize(1);
+
+			for (std::uint32_t index = 0; index < 100; ++index)
+			{
+				Datum originalInteger;
+				originalInteger = mHelper.GetRandomInt32();
+				integers.SetFromString(originalInteger.ToString());
+				Assert::IsTrue(integers == originalInteger);
+
+				Datum originalFloat;
+				originalFloat = std::floor(mHelper.GetRandomFloat() * 1000.0f) / 8.0f;
+				floats.SetFromString(originalFloat.ToString());
+				Assert::IsTrue(floats == originalFloat);
+				Assert::AreEqual(originalFloat.ToString(), floats.ToString());
+
+				// the text keeps six decimals, so parsing it again has to give the same text back
+				glm::vec4 vector = mHelper.GetRandomVec4();
+				vectors.Set(vector);
+				std::string vectorText = vectors.ToString();
+				vectors.SetFromString(vectorText);
+				Assert::AreEqual(vectorText, vectors.ToString());
+
+				glm::mat4 matrix = mHelper.GetRandomMat4();
+				matrices.Set(matrix);
+				std::string matrixText = matrices.ToString();
+				matrices.SetFromString(matrixText);
+				Assert::AreEqual(matrixText, matrices.ToString());
+			}
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			mHelper.Setup();
+		}
+
+		TEST_METHOD_CLEANUP(Teardown)
+		{
+			mHelper.Teardown();
+		}
+
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			mHelper.BeginClass();
+		}
+
+		TEST_CLASS_CLEANUP(CleanupClass)
+		{
+			mHelper.EndClass();
+		}
+
+	private:
+		// Compare two floats bit by bit, so signed zeros and rounding differences are caught
+		static void AssertSameFloat(float expected, float actual)
+		{
+			std::uint32_t expectedBits;
+			std::uint32_t actualBits;
+			std::memcpy(&expectedBits, &expected, sizeof(expected));
+			std::memcpy(&actualBits, &actual, sizeof(actual));
+			Assert::AreEqual(expectedBits, actualBits);
+		}
+
+		static TestClassHelper mHelper;
+	};
+
+	TestClassHelper NumberParserTest::mHelper;
+}
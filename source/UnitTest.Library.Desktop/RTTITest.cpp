@@ -0,0 +1,118 @@
+#include "Pch.h"
+#include "Attributed.h"
+#include "AttributedFoo.h"
+#include "AttributedBar.h"
+#include "Foo.h"
+#include "HashedName.h"
+#include "RTTI.h"
+#include "TestClassHelper.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTestLibraryDesktop
+{
+	typedef AnonymousEngine::Attributed Attributed;
+	typedef AnonymousEngine::Scope Scope;
+	typedef AnonymousEngine::RTTI RTTI;
+	typedef AnonymousEngine::HashedName HashedName;
+
+	TEST_CLASS(RTTITest)
+	{
+	public:
+		TEST_METHOD(TestTypeHierarchy)
+		{
+			static_assert(AttributedBar::TypeDepth == AttributedFoo::TypeDepth + 1U && Scope::TypeDepth == 1U, "Depths are known at compile time");
+			AttributedBar bar;
+			const RTTI& rtti = bar;
+
+			const RTTI::TypeHierarchy& hierarchy = rtti.TypeHierarchyInstance();
+			Assert::IsTrue(AttributedBar::TypeDepth == hierarchy.mDepth);
+			Assert::IsTrue(&hierarchy == &AttributedBar::TypeHierarchyClass());
+			Assert::IsTrue(Scope::TypeIdClass() == hierarchy.mIds[Scope::TypeDepth]);
+			Assert::IsTrue(Attributed::TypeIdClass() == hierarchy.mIds[Attributed::TypeDepth]);
+			Assert::AreEqual(std::string("AttributedFoo"), std::string(hierarchy.mNames[AttributedFoo::TypeDepth]));
+		}
+
+		TEST_METHOD(TestIsOnDeepTypes)
+		{
+			static_assert(AttributedFoo::TypeDepth == 3U && AttributedBar::TypeDepth == 4U, "The types under test are deep");
+			AttributedBar bar;
+			AttributedFoo foo;
+			const RTTI& rtti = bar;
+
+			// checked against the ancestor at the depth of the class
+			Assert::IsTrue(rtti.Is<Scope>() && rtti.Is<Attributed>() && rtti.Is<AttributedFoo>() && rtti.Is<AttributedBar>());
+			Assert::IsTrue(foo.Is<AttributedFoo>());
+			Assert::IsFalse(foo.Is<AttributedBar>());
+			Assert::IsFalse(rtti.Is<Foo>());
+			Assert::IsTrue(&bar == rtti.As<AttributedFoo>());
+			Assert::IsTrue(&bar == rtti.As<AttributedBar>());
+			Assert::IsNull(foo.As<AttributedBar>());
+
+			// checked by walking the ancestors
+			Assert::IsTrue(rtti.Is(Scope::TypeIdClass()));
+			Assert::IsTrue(rtti.Is(AttributedFoo::TypeIdClass()));
+			Assert::IsTrue(rtti.Is(AttributedBar::TypeIdClass()));
+			Assert::IsTrue(foo.Is(AttributedFoo::TypeIdClass()));
+			Assert::IsFalse(foo.Is(AttributedBar::TypeIdClass()));
+			Assert::IsFalse(rtti.Is(Foo::TypeIdClass()));
+		}
+
+		TEST_METHOD(TestQueryInterfaceOnDeepTypes)
+		{
+			AttributedBar bar;
+			AttributedFoo foo;
+			const RTTI& rtti = bar;
+
+			Assert::IsTrue(&bar == rtti.QueryInterface(AttributedBar::TypeIdClass()));
+			Assert::IsTrue(&bar == rtti.QueryInterface(AttributedFoo::TypeIdClass()));
+			Assert::IsTrue(&bar == rtti.QueryInterface(Attributed::TypeIdClass()));
+			Assert::IsTrue(&bar == rtti.QueryInterface(Scope::TypeIdClass()));
+			Assert::IsNull(rtti.QueryInterface(Foo::TypeIdClass()));
+			Assert::IsTrue(&foo == foo.QueryInterface(AttributedFoo::TypeIdClass()));
+			Assert::IsNull(foo.QueryInterface(AttributedBar::TypeIdClass()));
+		}
+
+		TEST_METHOD(TestIsByName)
+		{
+			AttributedBar bar;
+			AttributedFoo foo;
+			const RTTI& rtti = bar;
+
+			// names are matched by their hash and then their characters
+			Assert::IsTrue(rtti.Is("Attributed"));
+			Assert::IsTrue(rtti.Is(HashedName("AttributedBar")));
+			Assert::IsTrue(foo.Is(std::string("Scope")));
+			Assert::IsFalse(foo.Is("AttributedBar"));
+			Assert::IsFalse(foo.Is("Attributed2"));
+			Assert::IsFalse(foo.Is("Attribute"));
+			Assert::IsFalse(foo.Is("RTTI"));
+			Assert::IsFalse(foo.Is(""));
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			mHelper.Setup();
+		}
+
+		TEST_METHOD_CLEANUP(Teardown)
+		{
+			mHelper.Teardown();
+		}
+
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			mHelper.BeginClass();
+		}
+
+		TEST_CLASS_CLEANUP(CleanupClass)
+		{
+			mHelper.EndClass();
+		}
+
+	private:
+		static TestClassHelper mHelper;
+	};
+
+	TestClassHelper RTTITest::mHelper;
+}
@@ -211,6 +211,80 @@ namespace UnitTestLibraryDesktop
 			Foo temp;
 		}
 
+		TEST_METHOD(TestNodePool)
+		{
+			AnonymousEngine::NodePool pool;
+			Assert::AreEqual(0U, pool.SlabCount());
+
+			// freed blocks are handed out again before a new slab is taken
+			void* first = pool.Allocate(sizeof(Foo));
+			pool.Free(first);
+			Assert::IsTrue(first == pool.Allocate(sizeof(Foo)));
+			for (std::uint32_t index = 1; index < AnonymousEngine::NodePool::FirstSlabBlocks; ++index)
+			{
+				pool.Allocate(sizeof(Foo));
+			}
+			Assert::AreEqual(1U, pool.SlabCount());
+			pool.Allocate(sizeof(Foo));
+			Assert::AreEqual(2U, pool.SlabCount());
+			Assert::ExpectException<std::invalid_argument>([&pool] { pool.Allocate(sizeof(Foo) * 4); });
+
+			AnonymousEngine::NodePool moved(std::move(pool));
+			Assert::AreEqual(0U, pool.SlabCount());
+			Assert::AreEqual(2U, moved.SlabCount());
+			moved.Release();
+			Assert::AreEqual(0U, moved.SlabCount());
+
+			// a pool starting at one block grows one slab at a time, doubling its size
+			AnonymousEngine::NodePool single(1U);
+			single.Allocate(sizeof(Foo));
+			Assert::AreEqual(1U, single.SlabCount());
+			single.Allocate(sizeof(Foo));
+			single.Allocate(sizeof(Foo));
+			Assert::AreEqual(2U, single.SlabCount());
+			single.Allocate(sizeof(Foo));
+			Assert::AreEqual(3U, single.SlabCount());
+			Assert::ExpectException<std::invalid_argument>([] { AnonymousEngine::NodePool pool(0U); });
+			Assert::ExpectException<std::invalid_argument>([] { AnonymousEngine::NodePool pool(AnonymousEngine::NodePool::MaxSlabBlocks + 1U); });
+		}
+
+		TEST_METHOD(TestNodeAllocators)
+		{
+			std::uint32_t value = mHelper.GetRandomUInt32();
+			AnonymousEngine::SList<Foo> list;
+			for (std::uint32_t index = 0; index < 100; ++index)
+			{
+				list.PushBack(Foo(value + index));
+				list.PopFront();
+			}
+			list.PushFront(Foo(value));
+
+			// copies and moves keep the items apart from the pool they came from
+			AnonymousEngine::SList<Foo> copy(list);
+			AnonymousEngine::SList<Foo> moved(std::move(list));
+			list.PushBack(Foo(value));
+			copy.Clear();
+			Assert::AreEqual(Foo(value), moved.Front());
+			Assert::AreEqual(Foo(value), list.Front());
+
+			// lists can share a pool owned by someone else
+			AnonymousEngine::NodePool pool;
+			{
+				AnonymousEngine::SList<Foo, AnonymousEngine::SharedNodeAllocator> first((AnonymousEngine::SharedNodeAllocator(&pool)));
+				AnonymousEngine::SList<Foo, AnonymousEngine::SharedNodeAllocator> second((AnonymousEngine::SharedNodeAllocator(&pool)));
+				first.PushBack(Foo(value));
+				second.PushBack(Foo(value));
+				second = first;
+				Assert::AreEqual(1U, second.Size());
+				Assert::AreEqual(1U, pool.SlabCount());
+			}
+			pool.Release();
+
+			AnonymousEngine::SList<Foo, AnonymousEngine::SharedNodeAllocator> unpooled;
+			unpooled.PushBack(Foo(value));
+			Assert::AreEqual(Foo(value), unpooled.Back());
+		}
+
 		TEST_CLASS_INITIALIZE(InitializeClass)
 		{
 			mHelper.BeginClass();
@@ -253,6 +253,33 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(dStr1 == *const_cast<const Scope&>(scope).Search("string"));
 		}
 
+		TEST_METHOD(TestHashedNames)
+		{
+			static constexpr AnonymousEngine::HashedName IntName("int");
+			static constexpr AnonymousEngine::HashedName StringName("string");
+			static constexpr AnonymousEngine::HashedName MissingName("missing");
+			Scope scope;
+			scope[IntName] = mHelper.GetRandomInt32();
+			Scope& childScope = scope.AppendScope("child");
+			childScope["int"] = mHelper.GetRandomInt32();
+
+			Assert::IsTrue(scope.Find("int") == scope.Find(IntName));
+			Assert::IsTrue(&scope[IntName] == scope.Find("int"));
+			Assert::IsTrue(nullptr == scope.Find(MissingName));
+			Assert::IsTrue(childScope.Find("int") == childScope.Search(IntName));
+			Assert::IsTrue(nullptr == childScope.Search(MissingName));
+
+			// a missing name is only added by the non const operator
+			const Scope& constScope = scope;
+			Assert::ExpectException<std::invalid_argument>([&constScope] { constScope[StringName]; });
+			Datum& datum = scope[StringName];
+			Assert::AreEqual(3U, scope.Size());
+			Assert::IsTrue(&datum == &constScope[StringName]);
+			Scope* foundScope = nullptr;
+			Assert::IsTrue(&datum == childScope.Search(StringName, &foundScope));
+			Assert::IsTrue(foundScope == &scope);
+		}
+
 		TEST_METHOD(TestAdopt)
 		{
 			std::int32_t int1 = mHelper.GetRandomInt32();
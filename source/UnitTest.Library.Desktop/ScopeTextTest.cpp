@@ -0,0 +1,218 @@
+#include "Pch.h"
+#include <cstring>
+#include <sstream>
+#include "ActionList.h"
+#include "AttributedFoo.h"
+#include "CreateAction.h"
+#include "DestroyAction.h"
+#include "Entity.h"
+#include "HeadlessSimulation.h"
+#include "ScopeTextReader.h"
+#include "ScopeTextWriter.h"
+#include "SetValue.h"
+#include "Switch.h"
+#include "TestClassHelper.h"
+#include "World.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace UnitTestLibraryDesktop
+{
+	using namespace AnonymousEngine;
+	using namespace AnonymousEngine::Containers;
+
+	TEST_CLASS(ScopeTextTest)
+	{
+	public:
+		TEST_METHOD(TestFormat)
+		{
+			Scope scope;
+			scope["Name"] = std::string("hero");
+			scope["Age"] = -27;
+			scope["Attack"] = 10.5f;
+			scope["Position"] = glm::vec4(0.5f, 10.25f, 100.0f, 1.0f);
+			scope.Append("Empty");
+			scope["Tags"] = std::string("brave");
+			scope["Tags"].PushBack(std::string("tall"));
+			scope.AppendScope("Child")["Level"] = 2;
+			scope.AppendScope("Items");
+			scope.AppendScope("Items")["Count"] = 3;
+
+			const std::string expected = "{\"Name\": \"hero\", \"Age\": \"-27\", \"Attack\": \"10.500000\", "
+				"\"Position\": \"0.500000,10.250000,100.000000,1.000000\", \"Tags\": [\"brave\", \"tall\"], "
+				"\"Child\": {\"Level\": \"2\"}, \"Items\": [{}, {\"Count\": \"3\"}]}";
+			ScopeTextWriter writer;
+			Assert::AreEqual(expected, writer.Write(scope));
+			Assert::AreEqual(expected, scope.ToString());
+
+			// the buffer is reused
+			Assert::AreEqual(expected, writer.Write(scope));
+			Assert::AreEqual(std::string("{}"), writer.Write(Scope()));
+
+			// quotes and backslashes are the only characters which change
+			Scope quoted;
+			quoted["Text"] = std::string("say \"hi\" \\o/");
+			Assert::AreEqual(std::string("{\"Text\": \"say \\\"hi\\\" \\\\o/\"}"), quoted.ToString());
+		}
+
+		TEST_METHOD(TestStream)
+		{
+			Scope scope;
+			for (std::uint32_t index = 0; index < 2000; ++index)
+			{
+				Scope& child = scope.AppendScope("Children");
+				child["Index"] = static_cast<std::int32_t>(index);
+				child["Transform"] = mHelper.GetRandomMat4();
+			}
+
+			ScopeTextWriter writer;
+			std::ostringstream out;
+			writer.Write(scope, out);
+			Assert::AreEqual(scope.ToString(), out.str());
+			Assert::IsTrue(out.str().size() > 64U * 1024U);
+		}
+
+		TEST_METHOD(TestShortestFloats)
+		{
+			Scope scope;
+			scope["Float"] = 0.1f;
+			scope["Vector"] = glm::vec4(1.0f, -2.5f, 1e-7f, 3e20f);
+			ScopeTextWriter writer(ScopeTextWriter::FloatFormat::Shortest);
+			Assert::AreEqual(std::string("{\"Float\": \"0.1\", \"Vector\": \"1.0,-2.5,1e-07,3e+20\"}"), writer.Write(scope));
+
+			Scope random;
+			for (std::uint32_t index = 0; index < 1000; ++index)
+			{
+				std::uint32_t bits = mHelper.GetRandomUInt32() & 0xBFFFFFFFU;
+				float value;
+				std::memcpy(&value, &bits, sizeof(value));
+				random["Values"].PushBack(value);
+			}
+
+			// every float comes back exactly, which six fixed decimals can't do
+			Scope loaded;
+			ScopeTextReader reader;
+			reader.Read(writer.Write(random), loaded);
+			Assert::IsTrue(loaded == random);
+		}
+
+		TEST_METHOD(TestShortestWholeFloats)
+		{
+			Scope scope;
+			scope["Zero"] = 0.0f;
+			scope["One"] = 1.0f;
+			scope["Negative"] = -3.0f;
+			scope["Large"] = 1e10f;
+			scope["Mixed"] = 2.0f;
+			scope["Mixed"].PushBack(2.5f);
+			ScopeTextWriter writer(ScopeTextWriter::FloatFormat::Shortest);
+			const std::string& text = writer.Write(scope);
+			Assert::AreEqual(std::string("{\"Zero\": \"0.0\", \"One\": \"1.0\", \"Negative\": \"-3.0\", \"Large\": \"1e+10\", \"Mixed\": [\"2.0\", \"2.5\"]}"), text);
+
+			// whole numbers still read back as floats, so later values aren't truncated to integers
+			Scope loaded;
+			ScopeTextReader reader;
+			reader.Read(text, loaded);
+			Assert::IsTrue(loaded["One"].Type() == Datum::DatumType::Float);
+			Assert::IsTrue(loaded["Mixed"].Type() == Datum::DatumType::Float);
+			Assert::AreEqual(2.5f, loaded["Mixed"].Get<float>(1));
+			Assert::IsTrue(loaded == scope);
+		}
+
+		TEST_METHOD(TestReadBack)
+		{
+			EntityFactory entityFactory;
+			ActionListFactory actionFactory;
+			CreateActionFactory createActionFactory;
+			DestroyActionFactory destroyActionFactory;
+			SetValueFactory setValueFactory;
+			SwitchFactory switchFactory;
+
+			World* world = HeadlessSimulation::LoadWorld("TestData/world.xml");
+			std::string text = world->ToString();
+			Scope loaded;
+			ScopeTextReader reader;
+			reader.Read(text, loaded);
+			Assert::AreEqual(text, loaded.ToString());
+			delete world;
+
+			// types are inferred from the values
+			Scope scope;
+			reader.Read("{ \"Int\": \"-5\", \"Float\": \"2.5\", \"Vector\": \"1,2,3,4\", \"Text\": \"1,2\", \"Words\": [\"a\", \"b\"],"
+				" \"Matrix\": \"1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1\", \"Quoted\": \"\\\"\\\\\", \"Child\": {}}", scope);
+			Assert::IsTrue(scope["Int"] == -5);
+			Assert::IsTrue(scope["Float"] == 2.5f);
+			Assert::IsTrue(scope["Vector"] == glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+			Assert::IsTrue(scope["Text"] == std::string("1,2"));
+			Assert::AreEqual(2U, scope["Words"].Size());
+			Assert::IsTrue(scope["Matrix"] == glm::mat4(1.0f));
+			Assert::IsTrue(scope["Quoted"] == std::string("\"\\"));
+			Assert::IsTrue(scope["Child"].Type() == Datum::DatumType::Scope);
+
+			// typed datums keep their type
+			Scope typed;
+			typed["Text"] = std::string();
+			typed["Float"] = 0.0f;
+			reader.Read("{\"Text\": \"10\", \"Float\": \"10\"}", typed);
+			Assert::IsTrue(typed["Text"] == std::string("10"));
+			Assert::IsTrue(typed["Float"] == 10.0f);
+		}
+
+		TEST_METHOD(TestReadPrescribedAttributes)
+		{
+			AttributedFoo foo;
+			ScopeTextReader reader;
+			reader.Read("{\"mInt\": \"5\", \"mString\": \"five\", \"mVec4\": \"1,2,3,4\", \"mRtti\": \"ignored\","
+				" \"mIntArray\": [\"1\", \"2\", \"3\", \"4\", \"5\"], \"mNestedScope\": {\"Inner\": \"1\"}, \"Extra\": \"1.5\"}", foo);
+			Assert::AreEqual(5, foo.mInt);
+			Assert::AreEqual(std::string("five"), foo.mString);
+			Assert::IsTrue(foo.mVec4 == glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+			Assert::AreEqual(5, foo["mIntArray"].Get<std::int32_t>(4));
+			Assert::IsNull(foo.mRtti);
+			Assert::AreEqual(1U, foo["mNestedScope"].Size());
+			Assert::IsTrue((*foo.mNestedScope)["Inner"] == 1);
+			Assert::IsTrue(foo["Extra"] == 1.5f);
+
+			Assert::ExpectException<std::runtime_error>([&reader, &foo] { reader.Read("{\"mIntArray\": [\"1\", \"2\"]}", foo); });
+			Assert::ExpectException<std::runtime_error>([&reader, &foo] { reader.Read("{\"mInt\": \"five\"}", foo); });
+			Assert::ExpectException<std::runtime_error>([&reader, &foo] { reader.Read("{\"mInt\": {}}", foo); });
+			Assert::ExpectException<std::runtime_error>([&reader, &foo] { reader.Read("{\"mNestedScope\": \"1\"}", foo); });
+		}
+
+		TEST_METHOD(TestMalformedText)
+		{
+			const char* texts[] = { "", "{", "}", "{\"a\"}", "{\"a\": }", "{\"a\": \"1}", "{\"a\": [\"1\" \"2\"]}", "{\"a\": [\"1\", }",
+				"{\"a\": \"1\" \"b\": \"2\"}", "{\"a\": \"1\"} extra", "{a: \"1\"}", "{\"a\": \"\\" };
+			ScopeTextReader reader;
+			for (const char* text : texts)
+			{
+				Scope scope;
+				Assert::ExpectException<std::runtime_error>([&reader, &scope, text] { reader.Read(text, scope); });
+			}
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			mHelper.Setup();
+		}
+
+		TEST_METHOD_CLEANUP(Teardown)
+		{
+			mHelper.Teardown();
+		}
+
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			mHelper.BeginClass();
+		}
+
+		TEST_CLASS_CLEANUP(CleanupClass)
+		{
+			mHelper.EndClass();
+		}
+
+		static TestClassHelper mHelper;
+	};
+
+	TestClassHelper ScopeTextTest::mHelper;
+}
@@ -1,6 +1,7 @@
 #include "Pch.h"
 #include "XmlParseMaster.h"
 #include "ScopeParseHelper.h"
+#include "FooXmlParseHelper.h"
 #include "TestClassHelper.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -135,6 +136,45 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestTagDispatch)
+		{
+			ScopeSharedData data;
+			XmlParseMaster parser(data);
+			ScopeParserHelper helper;
+			AnonymousEngine::Vector<std::string> tags = helper.Tags();
+			Assert::AreEqual(6U, tags.Size());
+			for (const auto& tag : { "integer", "float", "string", "vector", "matrix", "scope" })
+			{
+				Assert::IsTrue(tags.Find(tag) != tags.end());
+			}
+			Assert::IsTrue(helper.IsSharedDataSupported(data));
+			Assert::IsFalse(helper.IsSharedDataSupported(AnonymousEngine::Parsers::SharedData()));
+
+			// a catch all helper added first doesn't see elements of shared data it doesn't support
+			FooXmlParserHelper fooHelper;
+			Assert::IsTrue(fooHelper.Tags().IsEmpty());
+			Assert::IsFalse(fooHelper.IsSharedDataSupported(data));
+			parser.AddHelper(fooHelper);
+			parser.AddHelper(helper);
+			parser.Parse(TestXmlStrings[0]);
+			Scope* scope = data.ExtractScope();
+			Assert::AreEqual(TestScopeDataString, scope->ToString());
+			delete scope;
+
+			// once the shared data changes the catch all helper is offered the elements again
+			FooSharedData fooData;
+			parser.SetSharedData(fooData);
+			parser.Parse("<award name=\"E3\"><year value=\"2016\"/></award>");
+			Assert::AreEqual(std::string("{\"name\": \"E3\", \"year\": {\"value\": \"2016\"}}"), fooData.mAwardWinners->ToString());
+			delete fooData.mAwardWinners;
+
+			// handed shared data of another master directly, a helper declines its own tags too
+			const XML_Char* attributes[] = { "name", "Value", "value", "1", nullptr };
+			AnonymousEngine::Parsers::XmlAttributes attributeMap(attributes);
+			Assert::IsFalse(helper.StartElementHandler(fooData, "integer", attributeMap));
+			Assert::IsFalse(helper.EndElementHandler(fooData, "integer"));
+		}
+
 		TEST_METHOD(TestClone)
 		{
 			ScopeSharedData data1;
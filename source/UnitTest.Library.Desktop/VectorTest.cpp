@@ -182,6 +182,160 @@ namespace UnitTestLibraryDesktop
 			VectorTestTemplate<Foo>::TestRemoveElementRange(Foo(value1), Foo(value2), Foo(value3), Foo(value4));
 		}
 
+		TEST_METHOD(TestEmplaceBack)
+		{
+			std::uint32_t value1 = mHelper.GetRandomUInt32();
+			std::uint32_t value2 = mHelper.GetRandomUInt32();
+			VectorTestTemplate<std::uint32_t>::TestEmplaceBack(value1, value2);
+			VectorTestTemplate<std::uint32_t*>::TestEmplaceBack(&value1, &value2);
+			VectorTestTemplate<Foo>::TestEmplaceBack(Foo(value1), Foo(value2));
+		}
+
+		TEST_METHOD(TestInsertRange)
+		{
+			std::uint32_t value1 = mHelper.GetRandomUInt32();
+			std::uint32_t value2 = mHelper.GetRandomUInt32();
+			std::uint32_t value3 = mHelper.GetRandomUInt32();
+			std::uint32_t value4 = mHelper.GetRandomUInt32();
+			VectorTestTemplate<std::uint32_t>::TestInsertRange(value1, value2, value3, value4);
+			VectorTestTemplate<std::uint32_t*>::TestInsertRange(&value1, &value2, &value3, &value4);
+			VectorTestTemplate<Foo>::TestInsertRange(Foo(value1), Foo(value2), Foo(value3), Foo(value4));
+		}
+
+		TEST_METHOD(TestSwapRemove)
+		{
+			std::uint32_t value1 = mHelper.GetRandomUInt32();
+			std::uint32_t value2 = mHelper.GetRandomUInt32();
+			std::uint32_t value3 = mHelper.GetRandomUInt32();
+			VectorTestTemplate<std::uint32_t>::TestSwapRemove(value1, value2, value3);
+			VectorTestTemplate<std::uint32_t*>::TestSwapRemove(&value1, &value2, &value3);
+			VectorTestTemplate<Foo>::TestSwapRemove(Foo(value1), Foo(value2), Foo(value3));
+		}
+
+		TEST_METHOD(TestRelocation)
+		{
+			static_assert(AnonymousEngine::IsTriviallyRelocatable<std::uint32_t*>::value, "Pointers are moved with realloc");
+			static_assert(!AnonymousEngine::IsTriviallyRelocatable<std::string>::value, "Strings are moved one by one");
+
+			// short strings point into themselves, so copying their bytes would break them
+			AnonymousEngine::Vector<std::string> vector;
+			for (std::uint32_t index = 0; index < 100; ++index)
+			{
+				vector.PushBack(std::to_string(index));
+			}
+			vector.Remove(vector.begin(), vector.IteratorAt(50));
+			std::string values[] = { std::string("short"), std::string(100, 'x') };
+			vector.Insert(vector.begin(), values, values + 2);
+			vector.SwapRemove(vector.IteratorAt(2));
+			Assert::AreEqual(51U, vector.Size());
+			Assert::AreEqual(std::string("short"), vector[0]);
+			Assert::AreEqual(values[1], vector[1]);
+			Assert::AreEqual(std::string("99"), vector[2]);
+			Assert::AreEqual(std::string("98"), vector.Back());
+			for (std::uint32_t index = 3; index < vector.Size(); ++index)
+			{
+				Assert::AreEqual(std::to_string(index + 48), vector[index]);
+			}
+		}
+
+		TEST_METHOD(TestInsertFromItself)
+		{
+			// a full vector grows while its own items are inserted into it
+			AnonymousEngine::Vector<std::string> vector;
+			vector.Reserve(4U);
+			for (std::uint32_t index = 0; index < 4; ++index)
+			{
+				vector.PushBack(std::string(40, static_cast<char>('a' + index)));
+			}
+			vector.Insert(vector.IteratorAt(1), vector.begin(), vector.end());
+			Assert::AreEqual(8U, vector.Size());
+			const char expected[] = "aabcdbcd";
+			for (std::uint32_t index = 0; index < vector.Size(); ++index)
+			{
+				Assert::AreEqual(std::string(40, expected[index]), vector[index]);
+			}
+
+			// with room to spare the items which get shifted are still copied as they were
+			vector.Reserve(20U);
+			std::uint32_t capacity = vector.Capacity();
+			vector.Insert(vector.begin(), vector.IteratorAt(6), vector.end());
+			Assert::AreEqual(capacity, vector.Capacity());
+			Assert::AreEqual(10U, vector.Size());
+			Assert::AreEqual(std::string(40, 'c'), vector[0]);
+			Assert::AreEqual(std::string(40, 'd'), vector[1]);
+			Assert::AreEqual(std::string(40, 'a'), vector[2]);
+			Assert::AreEqual(std::string(40, 'd'), vector.Back());
+
+			// repeated inserts grow the capacity geometrically instead of one item at a time
+			AnonymousEngine::Vector<std::uint32_t> numbers;
+			std::uint32_t value = mHelper.GetRandomUInt32();
+			std::uint32_t reallocations = 0;
+			for (std::uint32_t index = 0; index < 100; ++index)
+			{
+				std::uint32_t previousCapacity = numbers.Capacity();
+				numbers.Insert(numbers.begin(), &value, &value + 1);
+				reallocations += (numbers.Capacity() != previousCapacity) ? 1 : 0;
+			}
+			Assert::AreEqual(100U, numbers.Size());
+			Assert::IsTrue(reallocations < 20U);
+		}
+
+		TEST_METHOD(TestInsertThrowingCopy)
+		{
+			struct ThrowingCopy
+			{
+				std::string mValue;
+				explicit ThrowingCopy(const std::string& value) : mValue(value) {}
+				ThrowingCopy(const ThrowingCopy& rhs) : mValue(rhs.mValue)
+				{
+					if (mValue == "throw")
+					{
+						throw std::runtime_error("Copy failed.");
+					}
+				}
+				ThrowingCopy(ThrowingCopy&&) = default;
+				ThrowingCopy& operator=(ThrowingCopy&&) = default;
+			};
+
+			AnonymousEngine::Vector<ThrowingCopy> vector;
+			vector.Reserve(8U);
+			vector.EmplaceBack(std::string("first"));
+			vector.EmplaceBack(std::string("second"));
+			ThrowingCopy values[] = { ThrowingCopy(std::string("inserted")), ThrowingCopy(std::string("throw")) };
+
+			// whether the vector has room or has to grow, a failed insert leaves it as it was
+			Assert::ExpectException<std::runtime_error>([&vector, &values] { vector.Insert(vector.IteratorAt(1), values, values + 2); });
+			Assert::AreEqual(2U, vector.Size());
+			Assert::AreEqual(std::string("first"), vector[0].mValue);
+			Assert::AreEqual(std::string("second"), vector[1].mValue);
+
+			vector.EmplaceBack(std::string("third"));
+			vector.EmplaceBack(std::string("fourth"));
+			vector.EmplaceBack(std::string("fifth"));
+			vector.EmplaceBack(std::string("sixth"));
+			vector.EmplaceBack(std::string("seventh"));
+			vector.EmplaceBack(std::string("eighth"));
+			Assert::AreEqual(vector.Size(), vector.Capacity());
+			Assert::ExpectException<std::runtime_error>([&vector, &values] { vector.Insert(vector.begin(), values, values + 2); });
+			Assert::AreEqual(8U, vector.Size());
+			Assert::AreEqual(std::string("first"), vector[0].mValue);
+			Assert::AreEqual(std::string("eighth"), vector.Back().mValue);
+
+			vector.Insert(vector.begin(), values, values + 1);
+			Assert::AreEqual(9U, vector.Size());
+			Assert::AreEqual(std::string("inserted"), vector[0].mValue);
+			Assert::AreEqual(std::string("first"), vector[1].mValue);
+		}
+
+		TEST_METHOD(TestDataAccess)
+		{
+			std::uint32_t value1 = mHelper.GetRandomUInt32();
+			std::uint32_t value2 = mHelper.GetRandomUInt32();
+			VectorTestTemplate<std::uint32_t>::TestDataAccess(value1, value2);
+			VectorTestTemplate<std::uint32_t*>::TestDataAccess(&value1, &value2);
+			VectorTestTemplate<Foo>::TestDataAccess(Foo(value1), Foo(value2));
+		}
+
 		TEST_METHOD(TestCustomIncrementStrategy)
 		{
 			std::uint32_t value1 = mHelper.GetRandomUInt32();
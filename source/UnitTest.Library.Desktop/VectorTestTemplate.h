@@ -34,10 +34,19 @@ namespace UnitTestLibraryDesktop
 	public:
 		static void TestDefaultConstructor()
 		{
+			// nothing is allocated until the first push
 			AnonymousEngine::Vector<T> vector;
-			AnonymousEngine::DefaultVectorCapacityStrategy strategy;
-			Assert::AreEqual(strategy(0, 0), vector.Capacity());
+			Assert::AreEqual(0U, vector.Capacity());
 			Assert::AreEqual(0U, vector.Size());
+			AnonymousEngine::Vector<T> reserved(5U);
+			Assert::AreEqual(5U, reserved.Capacity());
+			AnonymousEngine::Vector<T> copy(vector);
+			AnonymousEngine::Vector<T> moved(std::move(vector));
+			Assert::AreEqual(0U, copy.Capacity());
+			Assert::AreEqual(0U, moved.Capacity());
+
+			// the default growth policy takes no space
+			Assert::AreEqual(sizeof(T*) + 2U * sizeof(std::uint32_t), sizeof(AnonymousEngine::Vector<T>));
 		}
 
 		static void TestInitializerList(const T& value1, const T& value2, const T& value3)
@@ -85,7 +94,7 @@ namespace UnitTestLibraryDesktop
 		{
 			TestCapacityStrategy strategy;
 			AnonymousEngine::Vector<T>* vector1 = new AnonymousEngine::Vector<T>();
-			AnonymousEngine::Vector<T>* vector3 = new AnonymousEngine::Vector<T>();
+			AnonymousEngine::Vector<T, AnonymousEngine::CapacityStrategyAdaptor>* vector3 = new AnonymousEngine::Vector<T, AnonymousEngine::CapacityStrategyAdaptor>();
 			vector1->PushBack(value1);
 			vector1->PushBack(value2);
 			vector3->IncrementStrategy(&strategy);
@@ -93,8 +102,9 @@ namespace UnitTestLibraryDesktop
 			vector3->PushBack(value2);
 			std::uint32_t size = vector1->Size();
 			std::uint32_t capacity = vector1->Capacity();
+			std::uint32_t strategyCapacity = vector3->Capacity();
 			AnonymousEngine::Vector<T> vector2 = std::move(*vector1);
-			AnonymousEngine::Vector<T> vector4 = std::move(*vector3);
+			AnonymousEngine::Vector<T, AnonymousEngine::CapacityStrategyAdaptor> vector4 = std::move(*vector3);
 			delete vector1;
 			delete vector3;
 
@@ -103,7 +113,7 @@ namespace UnitTestLibraryDesktop
 			vector2.PushBack(value3);
 			vector2.PushBack(value4);
 			Assert::AreEqual(size + 2U, vector2.Size());
-			Assert::AreEqual(capacity, vector4.Capacity());
+			Assert::AreEqual(strategyCapacity, vector4.Capacity());
 			Assert::AreEqual(size, vector4.Size());
 			vector4.PushBack(value3);
 			vector4.PushBack(value4);
@@ -135,10 +145,11 @@ namespace UnitTestLibraryDesktop
 			AnonymousEngine::Vector<T> vector;
 			AnonymousEngine::DefaultVectorCapacityStrategy strategy;
 			Assert::AreEqual(0U, vector.Size());
-			Assert::AreEqual(strategy(0, 0), vector.Capacity());
+			Assert::AreEqual(0U, vector.Capacity());
 			Assert::IsTrue(vector.IsEmpty());
 			vector.PushBack(value);
 			Assert::IsFalse(vector.IsEmpty());
+			Assert::AreEqual(strategy(0, 0), vector.Capacity());
 		}
 
 		static void TestPushBack(const T& value1, const T& value2)
@@ -146,7 +157,7 @@ namespace UnitTestLibraryDesktop
 			AnonymousEngine::Vector<T> vector;
 			AnonymousEngine::DefaultVectorCapacityStrategy strategy;
 			Assert::AreEqual(0U, vector.Size());
-			Assert::AreEqual(strategy(0, 0), vector.Capacity());
+			Assert::AreEqual(0U, vector.Capacity());
 			Assert::IsTrue(vector.IsEmpty());
 			vector.PushBack(value1);
 			Assert::AreEqual(1U, vector.Size());
@@ -250,7 +261,7 @@ namespace UnitTestLibraryDesktop
 		{
 			AnonymousEngine::Vector<T> vector;
 			AnonymousEngine::DefaultVectorCapacityStrategy strategy;
-			Assert::AreEqual(strategy(0, 0), vector.Capacity());
+			Assert::AreEqual(0U, vector.Capacity());
 			vector.PushBack(value1);
 			vector.PushBack(value2);
 			vector.PushBack(value3);
@@ -364,11 +375,91 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(vector.end(), it);
 		}
 
-		static void TestCustomIncrementStrategy(const T& value1, const T& value2, const T& value3)
+		static void TestEmplaceBack(const T& value1, const T& value2)
+		{
+			AnonymousEngine::Vector<T> vector;
+			Assert::AreEqual(value1, *vector.EmplaceBack(value1));
+			T moved(value2);
+			Assert::AreEqual(value2, *vector.PushBack(std::move(moved)));
+			for (std::uint32_t index = 0; index < 10; ++index)
+			{
+				// the pushed item lives in the vector, which grows under it
+				vector.PushBack(vector[0]);
+			}
+			Assert::AreEqual(12U, vector.Size());
+			Assert::AreEqual(value1, vector.Back());
+			Assert::AreEqual(value2, vector[1]);
+		}
+
+		static void TestInsertRange(const T& value1, const T& value2, const T& value3, const T& value4)
+		{
+			AnonymousEngine::Vector<T> vector{ value1, value4 };
+			AnonymousEngine::Vector<T> middle{ value2, value3 };
+			auto it = vector.Insert(vector.IteratorAt(1), middle.begin(), middle.end());
+			Assert::AreEqual(4U, vector.Size());
+			Assert::AreEqual(value2, *it);
+			Assert::AreEqual(value1, vector[0]);
+			Assert::AreEqual(value3, vector[2]);
+			Assert::AreEqual(value4, vector[3]);
+
+			T values[] = { value4, value1 };
+			vector.Insert(vector.end(), values, values + 2);
+			vector.Insert(vector.begin(), values, values);
+			Assert::AreEqual(6U, vector.Size());
+			Assert::AreEqual(value1, vector.Back());
+			Assert::AreEqual(value1, vector.Front());
+
+			AnonymousEngine::Vector<T> other;
+			Assert::ExpectException<std::invalid_argument>([&vector, &other, &values] { vector.Insert(other.begin(), values, values + 1); });
+		}
+
+		static void TestSwapRemove(const T& value1, const T& value2, const T& value3)
+		{
+			AnonymousEngine::Vector<T> vector{ value1, value2, value3 };
+			Assert::IsTrue(vector.SwapRemove(vector.begin()));
+			Assert::AreEqual(2U, vector.Size());
+			Assert::AreEqual(value3, vector[0]);
+			Assert::AreEqual(value2, vector[1]);
+			Assert::IsTrue(vector.SwapRemove(vector.IteratorAt(1)));
+			Assert::AreEqual(value3, vector.Back());
+			Assert::IsFalse(vector.SwapRemove(vector.end()));
+
+			AnonymousEngine::Vector<T> other;
+			Assert::ExpectException<std::invalid_argument>([&vector, &other] { vector.SwapRemove(other.begin()); });
+		}
+
+		static void TestDataAccess(const T& value1, const T& value2)
 		{
 			AnonymousEngine::Vector<T> vector;
+			Assert::IsNull(vector.Data());
+			Assert::IsTrue(vector.Items().IsEmpty());
+			Assert::IsTrue(vector.Items().begin() == vector.Items().end());
+
+			vector.PushBack(value1);
+			vector.PushBack(value2);
+			vector.PushBack(value1);
+			Assert::IsTrue(vector.Data() == &vector[0]);
+			AnonymousEngine::Span<T> items = vector.Items();
+			Assert::AreEqual(3U, items.Size());
+			Assert::AreEqual(value2, items[1]);
+			std::uint32_t count = 0;
+			for (T& item : items)
+			{
+				Assert::IsTrue(&item == &vector[count++]);
+			}
+			Assert::AreEqual(3U, count);
+
+			const AnonymousEngine::Vector<T>& constVector = vector;
+			AnonymousEngine::Span<const T> constItems = constVector.Items();
+			Assert::IsTrue(constItems.Data() == constVector.Data());
+			Assert::AreEqual(value1, *(constItems.end() - 1));
+		}
+
+		static void TestCustomIncrementStrategy(const T& value1, const T& value2, const T& value3)
+		{
+			AnonymousEngine::Vector<T, AnonymousEngine::CapacityStrategyAdaptor> vector;
 			Assert::AreEqual(0U, vector.Size());
-			Assert::AreEqual(3U, vector.Capacity());
+			Assert::AreEqual(0U, vector.Capacity());
 			vector.PushBack(value1);
 			vector.PushBack(value2);
 			vector.PushBack(value3);
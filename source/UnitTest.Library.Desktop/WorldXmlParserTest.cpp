@@ -1,4 +1,6 @@
 #include "Pch.h"
+#include <fstream>
+#include <sstream>
 #include "CreateAction.h"
 #include "ActionList.h"
 #include "Entity.h"
@@ -11,6 +13,13 @@
 #include "GameClock.h"
 #include "SetValue.h"
 #include "Switch.h"
+#include "HeadlessSimulation.h"
+#include "JobSystem.h"
+#include "ParallelWorldLoader.h"
+#include "EventQueue.h"
+#include "Event.h"
+#include "Foo.h"
+#include "FooSubscriber.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -60,6 +69,43 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestParseInChunks)
+		{
+			Containers::EntityFactory entityFactory;
+			Containers::ActionListFactory actionFactory;
+			Containers::CreateActionFactory createActionFactory;
+			Containers::DestroyActionFactory destroyActionFactory;
+			Containers::SetValueFactory setValueFactory;
+			Containers::SwitchFactory switchFactory;
+
+			WorldSharedData data;
+			XmlParseMaster parser(data);
+			WorldParserHelper helper;
+			parser.AddHelper(helper);
+
+			// element boundaries falling anywhere inside a chunk should not matter
+			std::uint32_t chunkSizes[] = { 1U, 7U, 64U, (mHelper.GetRandomUInt32() % 1024) + 1, XmlParseMaster::DefaultChunkSize };
+			for (std::uint32_t chunkSize : chunkSizes)
+			{
+				parser.ParseFromFile(TestXmlFiles[0], chunkSize);
+				Containers::World* world = data.ExtractWorld();
+				Assert::AreEqual(TestWorldDataString, world->ToString());
+				delete world;
+
+				std::ifstream in(TestXmlFiles[0], std::ios::binary);
+				parser.ParseFromStream(in, chunkSize);
+				world = data.ExtractWorld();
+				Assert::AreEqual(TestWorldDataString, world->ToString());
+				delete world;
+			}
+
+			std::istringstream invalidXml(InvalidXmls[0] + "<world>");
+			Assert::ExpectException<std::runtime_error>([&parser, &invalidXml] { parser.ParseFromStream(invalidXml, 5U); });
+			std::istringstream emptyXml;
+			Assert::ExpectException<std::runtime_error>([&parser, &emptyXml] { parser.ParseFromStream(emptyXml); });
+			Assert::ExpectException<std::invalid_argument>([&parser] { parser.ParseFromFile(TestXmlFiles[0], 0U); });
+		}
+
 		TEST_METHOD(TestInitialize)
 		{
 			Containers::EntityFactory entityFactory;
@@ -122,6 +168,67 @@ namespace UnitTestLibraryDesktop
 			delete parser2;
 		}
 
+		TEST_METHOD(TestParallelLoad)
+		{
+			Containers::EntityFactory entityFactory;
+			Containers::ActionListFactory actionFactory;
+			Containers::CreateActionFactory createActionFactory;
+			Containers::DestroyActionFactory destroyActionFactory;
+			Containers::SetValueFactory setValueFactory;
+			Containers::SwitchFactory switchFactory;
+
+			Core::JobSystem jobSystem(3);
+			Parsers::ParallelWorldLoader loader(jobSystem);
+			Containers::World* world = loader.LoadFromFile(TestXmlFiles[0]);
+			Assert::AreEqual(2U, loader.SectorCount());
+			Assert::AreEqual(TestWorldDataString, world->ToString());
+			delete world;
+
+			// sector tags inside comments, nested sectors lists and mixed case tags don't confuse the split
+			std::string xml = "<?xml version=\"1.0\"?><World name=\"Big\"><!-- <sector name=\"Commented\"> --><Sectors>";
+			for (std::uint32_t index = 0; index < 20; ++index)
+			{
+				std::string name = std::to_string(index);
+				xml.append("<Sector name=\"Sector").append(name).append("\"><integer name=\"Index\" value=\"").append(name).append("\"/>");
+				xml.append("<entities><entity name=\"Entity").append(name).append("\" class=\"Entity\"><string name=\"Tag\" value=\"a > b\"/>");
+				xml.append("<actions><action name=\"Set\" class=\"SetValue\"><string name=\"Target\" value=\"Index\"/></action></actions>");
+				xml.append("</entity></entities></Sector>");
+			}
+			xml.append("<sector name=\"Empty\"/></Sectors><integer name=\"After\" value=\"1\"/></World>");
+
+			WorldSharedData data;
+			XmlParseMaster parser(data);
+			WorldParserHelper helper;
+			parser.AddHelper(helper);
+			parser.Parse(xml);
+			Containers::World* expected = data.ExtractWorld();
+
+			world = loader.Load(xml);
+			Assert::AreEqual(21U, loader.SectorCount());
+			Assert::AreEqual(expected->ToString(), world->ToString());
+			Assert::AreEqual(21U, world->Sectors().Size());
+			for (std::uint32_t index = 0; index < world->Sectors().Size(); ++index)
+			{
+				Assert::IsTrue(world->Sectors().Get<Scope>(index).GetParent() == world);
+			}
+			delete expected;
+			delete world;
+
+			// a world without sectors is parsed on the calling thread alone
+			world = loader.Load("<world name=\"Empty\"><integer name=\"Population\" value=\"5\"/></world>");
+			Assert::AreEqual(0U, loader.SectorCount());
+			Assert::AreEqual(0U, world->Sectors().Size());
+			delete world;
+
+			// a broken sector fails the whole load and the loader can be used again
+			Assert::ExpectException<std::runtime_error>([&loader] { loader.Load("<world name=\"W\"><sectors><sector name=\"S\"><integer name=\"A\" value=\"1\"></sector></sectors></world>"); });
+			Assert::ExpectException<std::runtime_error>([&loader] { loader.Load("<world name=\"W\"><sectors><sector name=\"S\"/></sectors>"); });
+			Assert::ExpectException<std::runtime_error>([&loader] { loader.LoadFromFile(mHelper.GetRandomString()); });
+			world = loader.LoadFromFile(TestXmlFiles[0]);
+			Assert::AreEqual(TestWorldDataString, world->ToString());
+			delete world;
+		}
+
 		TEST_METHOD(TestInvalidXmls)
 		{
 			Containers::EntityFactory entityFactory;
@@ -195,6 +302,66 @@ namespace UnitTestLibraryDesktop
 			delete world;
 		}
 
+		TEST_METHOD(TestHeadlessSimulation)
+		{
+			typedef AnonymousEngine::Containers::HeadlessSimulation HeadlessSimulation;
+
+			Containers::EntityFactory entityFactory;
+			Containers::ActionListFactory actionFactory;
+			Containers::CreateActionFactory createActionFactory;
+			Containers::DestroyActionFactory destroyActionFactory;
+			Containers::SetValueFactory setValueFactory;
+			Containers::SwitchFactory switchFactory;
+
+			Containers::World* world = HeadlessSimulation::LoadWorld(TestXmlFiles[0]);
+			Assert::AreEqual(TestWorldDataString, world->ToString());
+
+			Core::EventQueue queue;
+			Assert::ExpectException<std::invalid_argument>([&world, &queue] { HeadlessSimulation(*world, queue, milliseconds(0)); });
+			HeadlessSimulation simulation(*world, queue, milliseconds(20));
+			Assert::IsTrue(simulation.Step() == milliseconds(20));
+
+			// events are delivered on the simulated clock
+			// the subscriber keeps pointing at the message, so the event is kept alive after the queue lets go of it
+			FooSubscriber fooSubscriber;
+			Core::Event<Foo>::Subscribe(fooSubscriber);
+			Foo fooData(mHelper.GetRandomUInt32());
+			auto fooEvent = std::make_shared<Core::Event<Foo>>(fooData);
+			queue.Enqueue(fooEvent, simulation.State().mGameTime, 50U);
+
+			simulation.Tick();
+			Assert::AreEqual(1013, (*world)["Population"].Get<std::int32_t>());
+			simulation.Tick();
+			Assert::AreEqual(1001, (*world)["Population"].Get<std::int32_t>());
+			Assert::IsFalse(fooSubscriber.IsNotified());
+			simulation.Tick();
+			Assert::IsTrue(fooSubscriber.IsNotified());
+			Assert::IsTrue(fooData == *fooSubscriber.EventData());
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::IsTrue(simulation.WallTime() == high_resolution_clock::duration(0));
+			Assert::AreEqual(0.0, simulation.TicksPerSecond());
+
+			simulation.Run(7U);
+			Assert::AreEqual(10ULL, static_cast<unsigned long long>(simulation.Ticks()));
+			Assert::IsTrue(simulation.SimulatedTime() == milliseconds(200));
+			Assert::AreEqual(100, (*world)["Population"].Get<std::int32_t>());
+			Containers::Sector& sector = static_cast<Containers::Sector&>((*world).Sectors().Get<Scope>());
+			Assert::AreEqual(20, sector["BanneredMareBeds"].Get<std::int32_t>());
+			Assert::IsTrue(simulation.TicksPerSecond() > 0.0);
+
+			simulation.RunFor(milliseconds(50));
+			Assert::AreEqual(13ULL, static_cast<unsigned long long>(simulation.Ticks()));
+			Assert::IsTrue(simulation.SimulatedTime() == milliseconds(260));
+
+			simulation.Reset();
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(simulation.Ticks()));
+			Assert::IsTrue(simulation.SimulatedTime() == milliseconds(0));
+			Assert::AreEqual(0.0, simulation.TicksPerSecond());
+
+			Core::Event<Foo>::UnsubscribeAll();
+			delete world;
+		}
+
 		TEST_CLASS_INITIALIZE(InitializeClass)
 		{
 			mHelper.BeginClass();
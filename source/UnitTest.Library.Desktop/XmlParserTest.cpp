@@ -1,4 +1,6 @@
 #include "Pch.h"
+#include <fstream>
+#include "MemoryMappedFile.h"
 #include "XmlParseMaster.h"
 #include "FooXmlParseHelper.h"
 #include "TestClassHelper.h"
@@ -10,6 +12,7 @@ namespace UnitTestLibraryDesktop
 	TEST_CLASS(XmlParserTest)
 	{
 		typedef AnonymousEngine::Parsers::XmlParseMaster XmlParseMaster;
+		typedef AnonymousEngine::Parsers::XmlAttributes XmlAttributes;
 	public:
 		TEST_METHOD(TestConstructor)
 		{
@@ -94,6 +97,113 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestParseMappedXmlFiles)
+		{
+			for (const auto& xmlFile : TestXmlFiles)
+			{
+				FooSharedData data1;
+				XmlParseMaster parser1(data1);
+				FooXmlParserHelper helper1;
+				parser1.AddHelper(helper1);
+				parser1.ParseFromMappedFile(xmlFile);
+				Assert::AreEqual(TestScopeDataString, data1.mAwardWinners->ToString());
+				Assert::AreEqual(xmlFile, parser1.GetFileName());
+
+				// mapped and streamed parses build the same data
+				FooSharedData data2;
+				XmlParseMaster parser2(data2);
+				FooXmlParserHelper helper2;
+				parser2.AddHelper(helper2);
+				parser2.ParseFromFile(xmlFile);
+				Assert::IsTrue(data2.mAwardWinners->Equals(data1.mAwardWinners));
+				delete data1.mAwardWinners;
+				delete data2.mAwardWinners;
+			}
+
+			FooSharedData data;
+			XmlParseMaster parser(data);
+			Assert::ExpectException<std::runtime_error>([&parser] { parser.ParseFromMappedFile(mHelper.GetRandomString()); });
+		}
+
+		TEST_METHOD(TestMemoryMappedFile)
+		{
+			std::ifstream in(TestXmlFiles[0], std::ios::binary);
+			std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+			AnonymousEngine::MemoryMappedFile file;
+			Assert::IsFalse(file.IsOpen());
+			Assert::IsTrue(file.Data() == nullptr);
+			file.Open(TestXmlFiles[0]);
+			Assert::IsTrue(file.IsOpen());
+			Assert::AreEqual(static_cast<unsigned long long>(contents.size()), static_cast<unsigned long long>(file.Size()));
+			Assert::AreEqual(contents, std::string(file.Data(), static_cast<std::size_t>(file.Size())));
+
+			AnonymousEngine::MemoryMappedFile moved(std::move(file));
+			Assert::IsFalse(file.IsOpen());
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(file.Size()));
+			Assert::AreEqual(contents, std::string(moved.Data(), static_cast<std::size_t>(moved.Size())));
+
+			file = std::move(moved);
+			Assert::IsTrue(file.IsOpen());
+			Assert::IsFalse(moved.IsOpen());
+			file.Close();
+			Assert::IsFalse(file.IsOpen());
+			Assert::IsTrue(file.Data() == nullptr);
+
+			std::string missingFile = mHelper.GetRandomString();
+			Assert::ExpectException<std::runtime_error>([&missingFile] { AnonymousEngine::MemoryMappedFile missing(missingFile); });
+		}
+
+		TEST_METHOD(TestXmlAttributes)
+		{
+			const XML_Char* attributeArray[] = { "Name", "hero", "age", "27", "CLASS", "Entity", nullptr };
+			XmlAttributes attributes(attributeArray);
+			Assert::AreEqual(3U, attributes.Size());
+			Assert::IsFalse(attributes.IsEmpty());
+			Assert::IsTrue(attributes.ContainsKey("name"));
+			Assert::IsTrue(attributes.ContainsKey("class"));
+			Assert::IsFalse(attributes.ContainsKey("na"));
+			Assert::AreEqual(std::string("hero"), std::string(attributes["name"]));
+			Assert::AreEqual(std::string("Entity"), std::string(attributes.Find("class")));
+			Assert::IsTrue(attributes.Find("value") == nullptr);
+			Assert::ExpectException<std::invalid_argument>([&attributes] { attributes["value"]; });
+
+			// names match whatever the case of either side
+			Assert::IsTrue(attributes.ContainsKey("NAME"));
+			Assert::IsTrue(attributes.ContainsKey("Age"));
+			Assert::AreEqual(std::string("Entity"), std::string(attributes["Class"]));
+			Assert::IsFalse(attributes.ContainsKey("Names"));
+
+			// attributes are visited in document order
+			std::uint32_t index = 0;
+			for (const auto& attribute : attributes)
+			{
+				Assert::AreEqual(std::string(attributeArray[index]), std::string(attribute.first));
+				Assert::AreEqual(std::string(attributeArray[index + 1]), std::string(attribute.second));
+				index += 2;
+			}
+			Assert::AreEqual(6U, index);
+			auto it = attributes.end();
+			Assert::ExpectException<std::out_of_range>([&it] { ++it; });
+
+			const XML_Char* emptyArray[] = { nullptr };
+			XmlAttributes empty(emptyArray);
+			Assert::IsTrue(empty.IsEmpty());
+			Assert::AreEqual(0U, empty.Size());
+			Assert::IsTrue(empty.begin() == empty.end());
+		}
+
+		TEST_METHOD(TestParseMixedCaseNames)
+		{
+			FooSharedData data;
+			XmlParseMaster parser(data);
+			FooXmlParserHelper helper;
+			parser.AddHelper(helper);
+			parser.Parse("<AWARD Name=\"E3\"><Year VALUE=\"2016\"/></AWARD>");
+			Assert::AreEqual(std::string("{\"name\": \"E3\", \"year\": {\"value\": \"2016\"}}"), data.mAwardWinners->ToString());
+			delete data.mAwardWinners;
+		}
+
 		TEST_METHOD(TestInitialize)
 		{
 			FooSharedData data1;